@@ -13,6 +13,7 @@ public:
   int numberOfBuiltinApps() override;
   Escher::App::Snapshot * appSnapshotAtIndex(int index) override;
   void * currentAppBuffer() override { return &m_apps; };
+  size_t currentAppBufferSize() override { return sizeof(m_apps); }
 private:
   union Apps {
   public:
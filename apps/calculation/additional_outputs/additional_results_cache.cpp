@@ -0,0 +1,84 @@
+#include "additional_results_cache.h"
+#include "../../constant.h"
+#include "../../global_preferences.h"
+#include "../../shared/poincare_helpers.h"
+#include <ion.h>
+#include <assert.h>
+#include <string.h>
+
+using namespace Poincare;
+
+namespace Calculation {
+
+AdditionalResultsCache::Key::Key(Calculation::AdditionalInformationType type, const Expression e) :
+  Key()
+{
+  assert(!e.isUninitialized());
+  Preferences * preferences = Preferences::sharedPreferences();
+  m_data[0] = static_cast<uint8_t>(type);
+  m_data[1] = static_cast<uint8_t>(preferences->angleUnit());
+  m_data[2] = static_cast<uint8_t>(preferences->complexFormat());
+  m_data[3] = static_cast<uint8_t>(preferences->displayMode());
+  m_data[4] = preferences->numberOfSignificantDigits();
+  m_data[5] = static_cast<uint8_t>(GlobalPreferences::sharedGlobalPreferences()->unitFormat());
+  char * text = reinterpret_cast<char *>(m_data + k_numberOfSettings);
+  int length = Shared::PoincareHelpers::Serialize(e, text, Constant::MaxSerializedExpressionSize);
+  if (length >= Constant::MaxSerializedExpressionSize - 1) {
+    // The serialization may be truncated and would not identify e
+    return;
+  }
+  m_length = k_numberOfSettings + length;
+  /* The results are computed in the global context: they may depend on any
+   * record of the storage. */
+  m_storageChecksum = Ion::Storage::sharedStorage()->checksum();
+}
+
+bool AdditionalResultsCache::Key::operator==(const Key & other) const {
+  return isValid() && other.isValid()
+    && m_storageChecksum == other.m_storageChecksum
+    && m_length == other.m_length
+    && memcmp(m_data, other.m_data, m_length) == 0;
+}
+
+bool AdditionalResultsCache::restore(const Key & key, Layout layouts[k_maxNumberOfLayouts]) const {
+  if (key != m_key) {
+    return false;
+  }
+  const char * address = m_buffer;
+  for (int i = 0; i < k_maxNumberOfLayouts; i++) {
+    layouts[i] = Layout::LayoutFromAddress(address, m_layoutSizes[i]);
+    address += m_layoutSizes[i];
+  }
+  return true;
+}
+
+void AdditionalResultsCache::store(const Key & key, const Layout layouts[k_maxNumberOfLayouts]) {
+  invalidate();
+  if (!key.isValid()) {
+    return;
+  }
+  size_t usedSize = 0;
+  for (int i = 0; i < k_maxNumberOfLayouts; i++) {
+    size_t size = layouts[i].isUninitialized() ? 0 : layouts[i].size();
+    if (usedSize + size > k_bufferSize) {
+      // The results do not fit: they will be computed again
+      return;
+    }
+    if (size > 0) {
+      memcpy(m_buffer + usedSize, layouts[i].addressInPool(), size);
+    }
+    m_layoutSizes[i] = size;
+    usedSize += size;
+  }
+  m_key = key;
+}
+
+void AdditionalResultsCache::store(const Key & key) {
+  // Restoring the key gives no layouts
+  for (int i = 0; i < k_maxNumberOfLayouts; i++) {
+    m_layoutSizes[i] = 0;
+  }
+  m_key = key;
+}
+
+}
@@ -0,0 +1,61 @@
+#ifndef CALCULATION_ADDITIONAL_OUTPUTS_ADDITIONAL_RESULTS_CACHE_H
+#define CALCULATION_ADDITIONAL_OUTPUTS_ADDITIONAL_RESULTS_CACHE_H
+
+#include "../calculation.h"
+#include <poincare/expression.h>
+#include <poincare/layout.h>
+#include <stdint.h>
+
+namespace Calculation {
+
+/* AdditionalResultsCache keeps the layouts of the last additional results, so
+ * that displaying them again does not reduce and approximate anything. The
+ * layouts are copied out of the pool, where they take no space while they are
+ * not displayed. Illustrated results are kept by their controller: the cache
+ * only records their key, so that the app holds a single key. */
+
+class AdditionalResultsCache {
+public:
+  /* A Key identifies results by the type of the additional information, the
+   * preferences the computation depends on and the serialized expression it
+   * was computed from, which are all compared. The storage, which the results
+   * may also depend on, is identified by its checksum. */
+  class Key {
+  public:
+    // The default key identifies no results
+    Key() : m_storageChecksum(0), m_length(0) {}
+    /* The key is invalid if the serialization of e is truncated, as it would
+     * not identify e. */
+    Key(Calculation::AdditionalInformationType type, const Poincare::Expression e);
+    bool isValid() const { return m_length > 0; }
+    // An invalid key is equal to no key, not even to itself
+    bool operator==(const Key & other) const;
+    bool operator!=(const Key & other) const { return !(*this == other); }
+  private:
+    constexpr static int k_numberOfSettings = 6;
+    uint32_t m_storageChecksum;
+    uint16_t m_length;
+    uint8_t m_data[k_numberOfSettings + Constant::MaxSerializedExpressionSize];
+  };
+
+  constexpr static int k_maxNumberOfLayouts = 5;
+
+  // Return false and leave layouts untouched if the results of key are unknown
+  bool restore(const Key & key, Poincare::Layout layouts[k_maxNumberOfLayouts]) const;
+  // Results of an invalid key are not cached
+  void store(const Key & key, const Poincare::Layout layouts[k_maxNumberOfLayouts]);
+  // Record the key of results kept out of the cache
+  void store(const Key & key);
+  bool holds(const Key & key) const { return key == m_key; }
+  void invalidate() { m_key = Key(); }
+private:
+  constexpr static int k_bufferSize = 1024;
+  Key m_key;
+  // An uninitialized layout has a size of 0
+  uint16_t m_layoutSizes[k_maxNumberOfLayouts];
+  char m_buffer[k_bufferSize];
+};
+
+}
+
+#endif
@@ -19,9 +19,7 @@ void ComplexListController::viewWillAppear() {
   m_complexGraphCell.reload(); // compute labels
 }
 
-void ComplexListController::setExpression(Poincare::Expression e) {
-  IllustratedListController::setExpression(e);
-
+void ComplexListController::computeAdditionalResults() {
   Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
   Poincare::Preferences::ComplexFormat currentComplexFormat = preferences->complexFormat();
   if (currentComplexFormat == Poincare::Preferences::ComplexFormat::Real) {
@@ -39,8 +37,8 @@ void ComplexListController::setExpression(Poincare::Expression e) {
 
   // Set Complex illustration
   // Compute a and b as in Expression::hasDefinedComplexApproximation to ensure the same defined result
-  float a = Shared::PoincareHelpers::ApproximateToScalar<float>(RealPart::Builder(e.clone()), &context);
-  float b = Shared::PoincareHelpers::ApproximateToScalar<float>(ImaginaryPart::Builder(e.clone()), &context);
+  float a = Shared::PoincareHelpers::ApproximateToScalar<float>(RealPart::Builder(m_expression.clone()), &context);
+  float b = Shared::PoincareHelpers::ApproximateToScalar<float>(ImaginaryPart::Builder(m_expression.clone()), &context);
   m_model.setComplex(std::complex<float>(a,b));
 
   // Reset complex format as before
@@ -16,8 +16,9 @@ public:
   // ViewController
   void viewWillAppear() override;
 
-  void setExpression(Poincare::Expression e) override;
 private:
+  Calculation::AdditionalInformationType additionalInformationType() const override { return Calculation::AdditionalInformationType::Complex; }
+  void computeAdditionalResults() override;
   static constexpr char k_symbol[] = "z";
   const char * symbol() const override { return k_symbol; }
   Escher::HighlightCell * illustrationCell() override { return &m_complexGraphCell; }
@@ -74,6 +74,13 @@ void ExpressionsListController::setExpression(Poincare::Expression e) {
     m_layouts[i] = Layout();
   }
   m_expression = e;
+  AdditionalResultsCache * cache = App::app()->additionalResultsCache();
+  AdditionalResultsCache::Key key(additionalInformationType(), m_expression);
+  if (cache->restore(key, m_layouts)) {
+    return;
+  }
+  computeLayouts();
+  cache->store(key, m_layouts);
 }
 
 Poincare::Layout ExpressionsListController::layoutAtIndex(int index) {
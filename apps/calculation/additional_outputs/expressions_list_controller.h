@@ -3,6 +3,7 @@
 
 #include <poincare/expression.h>
 #include <apps/i18n.h>
+#include "additional_results_cache.h"
 #include "list_controller.h"
 
 namespace Calculation {
@@ -26,13 +27,15 @@ public:
   void setExpression(Poincare::Expression e) override;
 
 protected:
-  constexpr static int k_maxNumberOfRows = 5;
+  constexpr static int k_maxNumberOfRows = AdditionalResultsCache::k_maxNumberOfLayouts;
   int textAtIndex(char * buffer, size_t bufferSize, int index) override;
   Poincare::Expression m_expression;
   // Memoization of layouts
   mutable Poincare::Layout m_layouts[k_maxNumberOfRows];
 private:
   Poincare::Layout layoutAtIndex(int index);
+  // Compute m_layouts from m_expression
+  virtual void computeLayouts() = 0;
   virtual I18n::Message messageAtIndex(int index) = 0;
   // Cells
   Escher::ExpressionTableCellWithMessage m_cells[k_maxNumberOfRows];
@@ -99,8 +99,19 @@ void IllustratedListController::tableViewDidChangeSelection(SelectableTableView
 }
 
 void IllustratedListController::setExpression(Poincare::Expression e) {
-  m_calculationStore.deleteAll();
   m_expression = e.clone();
+  /* The calculation store and the illustration are kept when the view
+   * disappears: they only need to be computed again for another expression,
+   * or after other additional results replaced their key in the cache. */
+  AdditionalResultsCache * cache = App::app()->additionalResultsCache();
+  AdditionalResultsCache::Key key(additionalInformationType(), m_expression);
+  if (cache->holds(key)) {
+    return;
+  }
+  cache->invalidate();
+  m_calculationStore.deleteAll();
+  computeAdditionalResults();
+  cache->store(key);
 }
 
 Poincare::VariableContext IllustratedListController::illustratedListContext() {
@@ -42,6 +42,8 @@ protected:
 private:
   int textAtIndex(char * buffer, size_t bufferSize, int index) override;
   virtual const char * symbol() const = 0;
+  // Fill m_calculationStore and the illustration from m_expression
+  virtual void computeAdditionalResults() = 0;
   // Set the size of the buffer needed to store the additional calculation
   constexpr static int k_maxNumberOfAdditionalCalculations = 4;
   constexpr static int k_calculationStoreBufferSize = k_maxNumberOfAdditionalCalculations * (Calculation::k_minimalSize + sizeof(Calculation *));
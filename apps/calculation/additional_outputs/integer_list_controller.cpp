@@ -23,8 +23,7 @@ Integer::Base baseAtIndex(int index) {
   }
 }
 
-void IntegerListController::setExpression(Poincare::Expression e) {
-  ExpressionsListController::setExpression(e);
+void IntegerListController::computeLayouts() {
   static_assert(k_maxNumberOfRows >= k_indexOfFactorExpression + 1, "k_maxNumberOfRows must be greater than k_indexOfFactorExpression");
   assert(!m_expression.isUninitialized() && m_expression.type() == ExpressionNode::Type::BasedInteger);
   Integer integer = static_cast<BasedInteger &>(m_expression).integer();
@@ -10,9 +10,9 @@ public:
   IntegerListController(EditExpressionController * editExpressionController) :
     ExpressionsListController(editExpressionController) {}
 
-  void setExpression(Poincare::Expression e) override;
-
 private:
+  Calculation::AdditionalInformationType additionalInformationType() const override { return Calculation::AdditionalInformationType::Integer; }
+  void computeLayouts() override;
   static constexpr int k_indexOfFactorExpression = 3;
   I18n::Message messageAtIndex(int index) override;
 };
@@ -1,6 +1,7 @@
 #ifndef CALCULATION_ADDITIONAL_OUTPUTS_LIST_CONTROLLER_H
 #define CALCULATION_ADDITIONAL_OUTPUTS_LIST_CONTROLLER_H
 
+#include "../calculation.h"
 #include <apps/i18n.h>
 #include <escher/expression_table_cell_with_message.h>
 #include <escher/memoized_list_view_data_source.h>
@@ -38,6 +39,7 @@ protected:
     Escher::SelectableTableView m_selectableTableView;
   };
   virtual int textAtIndex(char * buffer, size_t bufferSize, int index) = 0;
+  virtual Calculation::AdditionalInformationType additionalInformationType() const = 0;
   InnerListController m_listController;
   EditExpressionController * m_editExpressionController;
 };
@@ -16,8 +16,7 @@ using namespace Shared;
 
 namespace Calculation {
 
-void MatrixListController::setExpression(Poincare::Expression e) {
-  ExpressionsListController::setExpression(e);
+void MatrixListController::computeLayouts() {
   assert(!m_expression.isUninitialized());
   static_assert(k_maxNumberOfRows >= k_maxNumberOfOutputRows, "k_maxNumberOfRows must be greater than k_maxNumberOfOutputRows");
 
@@ -45,35 +44,28 @@ void MatrixListController::setExpression(Poincare::Expression e) {
 
   bool mIsSquared = (static_cast<Matrix &>(m_expression).numberOfRows() == static_cast<Matrix &>(m_expression).numberOfColumns());
   size_t index = 0;
-  size_t messageIndex = 0;
   // 1. Matrix determinant if square matrix
   if (mIsSquared) {
     /* Determinant is reduced so that a null determinant can be detected.
      * However, some exceptions remain such as cos(x)^2+sin(x)^2-1 which will
      * not be reduced to a rational, but will be null in theory. */
     Expression determinant = Determinant::Builder(m_expression.clone()).reduce(reductionContext);
-    m_indexMessageMap[index] = messageIndex++;
     m_layouts[index++] = getLayoutFromExpression(determinant, context, preferences);
     // 2. Matrix inverse if invertible matrix
     // A squared matrix is invertible if and only if determinant is non null
     if (!determinant.isUndefined() && determinant.nullStatus(context) != ExpressionNode::NullStatus::Null) {
       // TODO: Handle ExpressionNode::NullStatus::Unknown
-      m_indexMessageMap[index] = messageIndex++;
       m_layouts[index++] = getLayoutFromExpression(MatrixInverse::Builder(m_expression.clone()), context, preferences);
     }
   }
   // 3. Matrix row echelon form
-  messageIndex = 2;
   Expression rowEchelonForm = MatrixRowEchelonForm::Builder(m_expression.clone());
-  m_indexMessageMap[index] = messageIndex++;
   m_layouts[index++] = getLayoutFromExpression(rowEchelonForm, context, preferences);
   /* 4. Matrix reduced row echelon form
    *    it can be computed from row echelon form to save computation time.*/
-  m_indexMessageMap[index] = messageIndex++;
   m_layouts[index++] = getLayoutFromExpression(MatrixReducedRowEchelonForm::Builder(rowEchelonForm), context, preferences);
   // 5. Matrix trace if square matrix
   if (mIsSquared) {
-    m_indexMessageMap[index] = messageIndex++;
     m_layouts[index++] = getLayoutFromExpression(MatrixTrace::Builder(m_expression.clone()), context, preferences);
   }
   // Reset complex format as before
@@ -97,7 +89,9 @@ Poincare::Layout MatrixListController::getLayoutFromExpression(Expression e, Con
 }
 
 I18n::Message MatrixListController::messageAtIndex(int index) {
-  // Message index is mapped in setExpression because it depends on the Matrix.
+  /* The message depends on the rows which were computed: a square matrix has
+   * the 5 rows, or only lacks the inverse, and any other matrix only has the
+   * row echelon forms. */
   assert(index < k_maxNumberOfOutputRows && index >=0);
   I18n::Message messages[k_maxNumberOfOutputRows] = {
     I18n::Message::AdditionalDeterminant,
@@ -105,7 +99,14 @@ I18n::Message MatrixListController::messageAtIndex(int index) {
     I18n::Message::AdditionalRowEchelonForm,
     I18n::Message::AdditionalReducedRowEchelonForm,
     I18n::Message::AdditionalTrace};
-  return messages[m_indexMessageMap[index]];
+  int numberOfRows = this->numberOfRows();
+  int messageIndex = index;
+  if (numberOfRows == 2) {
+    messageIndex += 2;
+  } else if (numberOfRows == k_maxNumberOfOutputRows - 1 && index > 0) {
+    messageIndex++;
+  }
+  return messages[messageIndex];
 }
 
 }
@@ -10,14 +10,12 @@ public:
   MatrixListController(EditExpressionController * editExpressionController) :
     ExpressionsListController(editExpressionController) {}
 
-  void setExpression(Poincare::Expression e) override;
-
 private:
+  Calculation::AdditionalInformationType additionalInformationType() const override { return Calculation::AdditionalInformationType::Matrix; }
+  void computeLayouts() override;
   I18n::Message messageAtIndex(int index) override;
   Poincare::Layout getLayoutFromExpression(Poincare::Expression e, Poincare::Context * context, Poincare::Preferences * preferences);
-  // Map from cell index to message index
   constexpr static int k_maxNumberOfOutputRows = 5;
-  int m_indexMessageMap[k_maxNumberOfOutputRows];
 };
 
 }
@@ -15,8 +15,7 @@ Integer extractInteger(const Expression e) {
   return static_cast<const BasedInteger &>(e).integer();
 }
 
-void RationalListController::setExpression(Poincare::Expression e) {
-  ExpressionsListController::setExpression(e);
+void RationalListController::computeLayouts() {
   assert(!m_expression.isUninitialized());
   static_assert(k_maxNumberOfRows >= 2, "k_maxNumberOfRows must be greater than 2");
 
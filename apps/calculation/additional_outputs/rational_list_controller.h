@@ -10,9 +10,9 @@ public:
   RationalListController(EditExpressionController * editExpressionController) :
     ExpressionsListController(editExpressionController) {}
 
-  void setExpression(Poincare::Expression e) override;
-
 private:
+  Calculation::AdditionalInformationType additionalInformationType() const override { return Calculation::AdditionalInformationType::Rational; }
+  void computeLayouts() override;
   I18n::Message messageAtIndex(int index) override;
   int textAtIndex(char * buffer, size_t bufferSize, int index) override;
 };
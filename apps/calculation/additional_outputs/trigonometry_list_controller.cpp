@@ -12,7 +12,9 @@ constexpr char TrigonometryListController::k_symbol[];
 void TrigonometryListController::setExpression(Poincare::Expression e) {
   assert(e.type() == ExpressionNode::Type::Cosine || e.type() == ExpressionNode::Type::Sine);
   IllustratedListController::setExpression(e.childAtIndex(0));
+}
 
+void TrigonometryListController::computeAdditionalResults() {
   VariableContext context = illustratedListContext();
 
   // Fill calculation store
@@ -14,6 +14,8 @@ public:
     m_graphCell(&m_model) {}
   void setExpression(Poincare::Expression e) override;
 private:
+  Calculation::AdditionalInformationType additionalInformationType() const override { return Calculation::AdditionalInformationType::Trigonometry; }
+  void computeAdditionalResults() override;
   static constexpr char k_symbol[] = "θ";
   const char * symbol() const override { return k_symbol; }
   Escher::HighlightCell * illustrationCell() override { return &m_graphCell; }
@@ -12,8 +12,7 @@ using namespace Shared;
 
 namespace Calculation {
 
-void UnitListController::setExpression(Poincare::Expression e) {
-  ExpressionsListController::setExpression(e);
+void UnitListController::computeLayouts() {
   assert(!m_expression.isUninitialized());
   static_assert(k_maxNumberOfRows >= 3, "k_maxNumberOfRows must be greater than 3");
 
@@ -10,9 +10,9 @@ public:
   UnitListController(EditExpressionController * editExpressionController) :
     ExpressionsListController(editExpressionController) {}
 
-  void setExpression(Poincare::Expression e) override;
-
 private:
+  Calculation::AdditionalInformationType additionalInformationType() const override { return Calculation::AdditionalInformationType::Unit; }
+  void computeLayouts() override;
   I18n::Message messageAtIndex(int index) override;
 };
 
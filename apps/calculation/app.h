@@ -1,6 +1,7 @@
 #ifndef CALCULATION_APP_H
 #define CALCULATION_APP_H
 
+#include "additional_outputs/additional_results_cache.h"
 #include "calculation_store.h"
 #include "edit_expression_controller.h"
 #include "history_controller.h"
@@ -38,6 +39,7 @@ public:
     return static_cast<App *>(Escher::Container::activeApp());
   }
   TELEMETRY_ID("Calculation");
+  AdditionalResultsCache * additionalResultsCache() { return &m_additionalResultsCache; }
   bool textFieldDidReceiveEvent(Escher::TextField * textField, Ion::Events::Event event) override;
   bool layoutFieldDidReceiveEvent(Escher::LayoutField * layoutField, Ion::Events::Event event) override;
   // TextFieldDelegateApp
@@ -49,6 +51,7 @@ private:
   void didBecomeActive(Escher::Window * window) override;
   void willBecomeInactive() override;
   EditExpressionController m_editExpressionController;
+  AdditionalResultsCache m_additionalResultsCache;
 };
 
 }
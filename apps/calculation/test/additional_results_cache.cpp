@@ -0,0 +1,85 @@
+#include <quiz.h>
+#include <apps/shared/global_context.h>
+#include <poincare/test/helper.h>
+#include <poincare_expressions.h>
+#include "../additional_outputs/additional_results_cache.h"
+
+typedef ::Calculation::Calculation::AdditionalInformationType AdditionalInformationType;
+
+using namespace Poincare;
+using namespace Calculation;
+
+QUIZ_CASE(calculation_additional_results_cache_key) {
+  typedef AdditionalResultsCache::Key Key;
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression("1/2", &globalContext, false);
+  Key key(AdditionalInformationType::Rational, e);
+  quiz_assert(key.isValid() && key == key);
+  quiz_assert(!Key().isValid() && Key() != Key() && Key() != key);
+  quiz_assert(Key(AdditionalInformationType::Rational, e.clone()) == key);
+  quiz_assert(Key(AdditionalInformationType::Rational, parse_expression("1/3", &globalContext, false)) != key);
+  quiz_assert(Key(AdditionalInformationType::Rational, parse_expression("1/22", &globalContext, false)) != key);
+  quiz_assert(Key(AdditionalInformationType::Complex, e) != key);
+
+  // The key depends on the preferences
+  Preferences * preferences = Preferences::sharedPreferences();
+  Preferences::AngleUnit angleUnit = preferences->angleUnit();
+  preferences->setAngleUnit(angleUnit == Preferences::AngleUnit::Radian ? Preferences::AngleUnit::Degree : Preferences::AngleUnit::Radian);
+  quiz_assert(Key(AdditionalInformationType::Rational, e) != key);
+  preferences->setAngleUnit(angleUnit);
+  quiz_assert(Key(AdditionalInformationType::Rational, e) == key);
+
+  // The key depends on the storage
+  Expression value = Rational::Builder(3);
+  quiz_assert(Ion::Storage::sharedStorage()->createRecordWithExtension("a", Ion::Storage::expExtension, value.addressInPool(), value.size()) == Ion::Storage::Record::ErrorStatus::None);
+  quiz_assert(Key(AdditionalInformationType::Rational, e) != key);
+  Ion::Storage::sharedStorage()->destroyAllRecords();
+  quiz_assert(Key(AdditionalInformationType::Rational, e) == key);
+}
+
+QUIZ_CASE(calculation_additional_results_cache) {
+  typedef AdditionalResultsCache::Key Key;
+  Shared::GlobalContext globalContext;
+  constexpr int numberOfLayouts = AdditionalResultsCache::k_maxNumberOfLayouts;
+  Layout layouts[numberOfLayouts];
+  layouts[0] = parse_expression("1/2", &globalContext, false).createLayout(Preferences::PrintFloatMode::Decimal, 10);
+  layouts[1] = parse_expression("2^3+√(5)", &globalContext, false).createLayout(Preferences::PrintFloatMode::Decimal, 10);
+  layouts[3] = parse_expression("[[1,2][3,4]]", &globalContext, false).createLayout(Preferences::PrintFloatMode::Decimal, 10);
+
+  AdditionalResultsCache cache;
+  Layout restoredLayouts[numberOfLayouts];
+  Key key(AdditionalInformationType::Matrix, Rational::Builder(1));
+  quiz_assert(!cache.restore(key, restoredLayouts));
+  cache.store(key, layouts);
+  quiz_assert(!cache.restore(Key(AdditionalInformationType::Matrix, Rational::Builder(2)), restoredLayouts));
+  quiz_assert(!cache.restore(Key(), restoredLayouts));
+  quiz_assert(cache.restore(key, restoredLayouts));
+  for (int i = 0; i < numberOfLayouts; i++) {
+    quiz_assert(restoredLayouts[i].isIdenticalTo(layouts[i]));
+  }
+
+  // Results which do not fit are not cached
+  Layout largeLayouts[numberOfLayouts];
+  for (int i = 0; i < numberOfLayouts; i++) {
+    largeLayouts[i] = parse_expression("[[1/2,2/3,3/4][4/5,5/6,6/7][7/8,8/9,9/10]]", &globalContext, false).createLayout(Preferences::PrintFloatMode::Decimal, 10);
+  }
+  cache.store(key, largeLayouts);
+  quiz_assert(!cache.restore(key, restoredLayouts));
+  cache.store(key, layouts);
+  cache.invalidate();
+  quiz_assert(!cache.restore(key, restoredLayouts));
+
+  // Illustrated results only record their key
+  Key illustratedKey(AdditionalInformationType::Complex, Rational::Builder(1));
+  cache.store(key, layouts);
+  quiz_assert(cache.holds(key) && !cache.holds(illustratedKey));
+  cache.store(illustratedKey);
+  quiz_assert(cache.holds(illustratedKey) && !cache.holds(key));
+  quiz_assert(!cache.restore(key, restoredLayouts));
+  quiz_assert(cache.restore(illustratedKey, restoredLayouts));
+  for (int i = 0; i < numberOfLayouts; i++) {
+    quiz_assert(restoredLayouts[i].isUninitialized());
+  }
+  cache.store(Key());
+  quiz_assert(!cache.holds(illustratedKey) && !cache.holds(Key()));
+}
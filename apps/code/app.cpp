@@ -30,7 +30,8 @@ App::Snapshot::Snapshot() :
 }
 
 App * App::Snapshot::unpack(Container * container) {
-  return new (container->currentAppBuffer()) App(this);
+  char * appBuffer = static_cast<char *>(container->currentAppBuffer());
+  return new (appBuffer) App(this, appBuffer + container->currentAppBufferSize());
 }
 
 static constexpr App::Descriptor sDescriptor;
@@ -68,9 +69,8 @@ void App::Snapshot::setOpt(const char * name, const char * value) {
 }
 #endif
 
-App::App(Snapshot * snapshot) :
+App::App(Snapshot * snapshot, char * appBufferEnd) :
   Shared::InputEventHandlerDelegateApp(snapshot, &m_codeStackViewController),
-  m_pythonHeap{},
   m_pythonUser(nullptr),
   m_consoleController(nullptr, this, snapshot->scriptStore()
 #if EPSILON_GETOPT
@@ -80,8 +80,11 @@ App::App(Snapshot * snapshot) :
   m_listFooter(&m_codeStackViewController, &m_menuController, &m_menuController, ButtonRowController::Position::Bottom, ButtonRowController::Style::EmbossedGray, ButtonRowController::Size::Large),
   m_menuController(&m_listFooter, this, snapshot->scriptStore(), &m_listFooter),
   m_codeStackViewController(&m_modalViewController, &m_listFooter),
-  m_variableBoxController(snapshot->scriptStore())
+  m_variableBoxController(snapshot->scriptStore()),
+  m_pythonHeapEnd(appBufferEnd),
+  m_pythonHeap{}
 {
+  assert(m_pythonHeapEnd >= reinterpret_cast<char *>(this) + sizeof(App));
   Clipboard::sharedClipboard()->enterPython();
 }
 
@@ -127,7 +130,7 @@ bool App::textInputDidReceiveEvent(InputEventHandler * textInput, Ion::Events::E
 
 void App::initPythonWithUser(const void * pythonUser) {
   if (!m_pythonUser) {
-    MicroPython::init(m_pythonHeap, m_pythonHeap + k_pythonHeapSize);
+    MicroPython::init(m_pythonHeap, m_pythonHeapEnd);
   }
   m_pythonUser = pythonUser;
 }
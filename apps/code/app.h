@@ -68,21 +68,24 @@ public:
   static constexpr int k_pythonHeapSize = 32768;
 
 private:
-  /* Python delegate:
-   * MicroPython requires a heap. To avoid dynamic allocation, we keep a working
-   * buffer here and we give to controllers that load Python environment. We
-   * also memoize the last Python user to avoid re-initiating MicroPython when
-   * unneeded. */
-  char m_pythonHeap[k_pythonHeapSize];
+  App(Snapshot * snapshot, char * appBufferEnd);
   const void * m_pythonUser;
-
-  App(Snapshot * snapshot);
   ConsoleController m_consoleController;
   Escher::ButtonRowController m_listFooter;
   MenuController m_menuController;
   Escher::StackViewController m_codeStackViewController;
   PythonToolbox m_toolbox;
   VariableBoxController m_variableBoxController;
+  /* Python delegate:
+   * MicroPython requires a heap. To avoid dynamic allocation, we keep a working
+   * buffer here and we give to controllers that load Python environment. We
+   * also memoize the last Python user to avoid re-initiating MicroPython when
+   * unneeded.
+   * The app buffer is sized after the largest app, so the end of the buffer is
+   * usually left unused by the Code app. The heap is the last member of App so
+   * that it can be extended up to m_pythonHeapEnd to borrow this space. */
+  char * m_pythonHeapEnd;
+  char m_pythonHeap[k_pythonHeapSize];
 };
 
 }
@@ -267,89 +267,81 @@ void PythonTextArea::ContentView::drawLine(KDContext * ctx, int line, const char
   }
 
   const char * autocompleteStart = m_autocomplete ? m_cursorLocation : nullptr;
+  const char * tokenEnd = firstNonSpace;
+
+  int numberOfSpans;
+  const SyntaxHighlightCache::Span * spans = m_syntaxHighlightCache.spans(text, byteLength, &numberOfSpans);
+  if (spans != nullptr) {
+    LOG_DRAW("Cached spans\n");
+    for (int i = 0; i < numberOfSpans; i++) {
+      drawToken(ctx, line, text, byteLength, text + spans[i].start, spans[i].length, spans[i].color, &tokenEnd, selectionStart, selectionEnd, autocompleteStart);
+    }
+  } else {
+    SyntaxHighlightCache::Span lexedSpans[SyntaxHighlightCache::k_maxNumberOfSpans];
+    numberOfSpans = 0;
+    bool cacheable = byteLength <= SyntaxHighlightCache::k_maxLineLength;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+      mp_lexer_t * lex = mp_lexer_new_from_str_len(0, firstNonSpace, byteLength - (firstNonSpace - text), 0);
+      LOG_DRAW("Pop token %d\n", lex->tok_kind);
 
-  nlr_buf_t nlr;
-  if (nlr_push(&nlr) == 0) {
-    mp_lexer_t * lex = mp_lexer_new_from_str_len(0, firstNonSpace, byteLength - (firstNonSpace - text), 0);
-    LOG_DRAW("Pop token %d\n", lex->tok_kind);
-
-    const char * tokenFrom = firstNonSpace;
-    size_t tokenLength = 0;
-    const char * tokenEnd = firstNonSpace;
-    while (lex->tok_kind != MP_TOKEN_NEWLINE && lex->tok_kind != MP_TOKEN_END) {
-      tokenFrom = firstNonSpace + lex->tok_column - 1;
-      if (tokenFrom != tokenEnd) {
-        // We passed over white spaces, we need to color them
-        drawStringAt(
-            ctx,
-            line,
-            UTF8Helper::GlyphOffsetAtCodePoint(text, tokenEnd),
-            tokenEnd,
-            std::min(text + byteLength, tokenFrom) - tokenEnd,
-            StringColor,
-            BackgroundColor,
-            selectionStart,
-            selectionEnd,
-            HighlightColor);
-      }
-      tokenLength = TokenLength(lex, tokenFrom);
-      tokenEnd = tokenFrom + tokenLength;
-
-      // If the token is being autocompleted, use DefaultColor
-      KDColor color = (tokenFrom <= autocompleteStart && autocompleteStart < tokenEnd) ? DefaultColor : TokenColor(lex->tok_kind);
-
-      if (color != DefaultColor && (lex->tok_kind == MP_TOKEN_INTEGER || lex->tok_kind == MP_TOKEN_FLOAT_OR_IMAG)) {
-        /* Check if the token can actually be parsed because lexer might label
-         * tokens that cannot be parsed as integer or float */
-        nlr_buf_t nlrNumberColorParse;
-        if (nlr_push(&nlrNumberColorParse) == 0) {
-          /* Use ex->vstr.len instead of tokenLength because it translates
-           * escaped chars as the interpreter would do. */
-          if (lex->tok_kind == MP_TOKEN_INTEGER) {
-            mp_parse_num_integer(tokenFrom, lex->vstr.len, 0, NULL);
+      while (lex->tok_kind != MP_TOKEN_NEWLINE && lex->tok_kind != MP_TOKEN_END) {
+        const char * tokenFrom = firstNonSpace + lex->tok_column - 1;
+        size_t tokenLength = TokenLength(lex, tokenFrom);
+        KDColor color = TokenColor(lex->tok_kind);
+
+        if (color != DefaultColor && (lex->tok_kind == MP_TOKEN_INTEGER || lex->tok_kind == MP_TOKEN_FLOAT_OR_IMAG)) {
+          /* Check if the token can actually be parsed because lexer might label
+           * tokens that cannot be parsed as integer or float */
+          nlr_buf_t nlrNumberColorParse;
+          if (nlr_push(&nlrNumberColorParse) == 0) {
+            /* Use ex->vstr.len instead of tokenLength because it translates
+             * escaped chars as the interpreter would do. */
+            if (lex->tok_kind == MP_TOKEN_INTEGER) {
+              mp_parse_num_integer(tokenFrom, lex->vstr.len, 0, NULL);
+            } else {
+              mp_parse_num_decimal(tokenFrom, lex->vstr.len, true, false, NULL);
+            }
+            nlr_pop();
           } else {
-            mp_parse_num_decimal(tokenFrom, lex->vstr.len, true, false, NULL);
+            // Parsing raised an exception, use DefaultColor.
+            color = DefaultColor;
           }
-          nlr_pop();
+        }
+
+        LOG_DRAW("Draw \"%.*s\" for token %d\n", tokenLength, tokenFrom, lex->tok_kind);
+        drawToken(ctx, line, text, byteLength, tokenFrom, tokenLength, color, &tokenEnd, selectionStart, selectionEnd, autocompleteStart);
+        if (numberOfSpans < SyntaxHighlightCache::k_maxNumberOfSpans) {
+          lexedSpans[numberOfSpans++] = {static_cast<uint8_t>(tokenFrom - text), static_cast<uint8_t>(tokenLength), color};
         } else {
-          // Parsing raised an exception, use DefaultColor.
-          color = DefaultColor;
+          cacheable = false;
         }
+
+        mp_lexer_to_next(lex);
+        LOG_DRAW("Pop token %d\n", lex->tok_kind);
       }
+      mp_lexer_free(lex);
+      nlr_pop();
+    } else {
+      cacheable = false;
+    }
+    if (cacheable) {
+      m_syntaxHighlightCache.store(text, byteLength, lexedSpans, numberOfSpans);
+    }
+  }
 
-      LOG_DRAW("Draw \"%.*s\" for token %d\n", tokenLength, tokenFrom, lex->tok_kind);
-      drawStringAt(ctx, line,
-        UTF8Helper::GlyphOffsetAtCodePoint(text, tokenFrom),
-        tokenFrom,
-        tokenLength,
-        color,
+  // Even if the token is being autocompleted, use CommentColor
+  if (tokenEnd < text + byteLength) {
+    LOG_DRAW("Draw comment \"%.*s\" from %d\n", byteLength - (tokenEnd - text), firstNonSpace, tokenEnd);
+    drawStringAt(ctx, line,
+        UTF8Helper::GlyphOffsetAtCodePoint(text, tokenEnd),
+        tokenEnd,
+        text + byteLength - tokenEnd,
+        CommentColor,
         BackgroundColor,
         selectionStart,
         selectionEnd,
         HighlightColor);
-
-      mp_lexer_to_next(lex);
-      LOG_DRAW("Pop token %d\n", lex->tok_kind);
-    }
-
-    tokenFrom += tokenLength;
-
-    // Even if the token is being autocompleted, use CommentColor
-    if (tokenFrom < text + byteLength) {
-      LOG_DRAW("Draw comment \"%.*s\" from %d\n", byteLength - (tokenFrom - text), firstNonSpace, tokenFrom);
-      drawStringAt(ctx, line,
-          UTF8Helper::GlyphOffsetAtCodePoint(text, tokenFrom),
-          tokenFrom,
-          text + byteLength - tokenFrom,
-          CommentColor,
-          BackgroundColor,
-          selectionStart,
-          selectionEnd,
-          HighlightColor);
-    }
-
-    mp_lexer_free(lex);
-    nlr_pop();
   }
 
   // Redraw the autocompleted word in the right color
@@ -369,6 +361,37 @@ void PythonTextArea::ContentView::drawLine(KDContext * ctx, int line, const char
   }
 }
 
+void PythonTextArea::ContentView::drawToken(KDContext * ctx, int line, const char * text, size_t byteLength, const char * tokenFrom, size_t tokenLength, KDColor color, const char ** previousTokenEnd, const char * selectionStart, const char * selectionEnd, const char * autocompleteStart) const {
+  if (tokenFrom != *previousTokenEnd) {
+    // We passed over white spaces, we need to color them
+    drawStringAt(
+        ctx,
+        line,
+        UTF8Helper::GlyphOffsetAtCodePoint(text, *previousTokenEnd),
+        *previousTokenEnd,
+        std::min(text + byteLength, tokenFrom) - *previousTokenEnd,
+        StringColor,
+        BackgroundColor,
+        selectionStart,
+        selectionEnd,
+        HighlightColor);
+  }
+  *previousTokenEnd = tokenFrom + tokenLength;
+  // If the token is being autocompleted, use DefaultColor
+  if (tokenFrom <= autocompleteStart && autocompleteStart < *previousTokenEnd) {
+    color = DefaultColor;
+  }
+  drawStringAt(ctx, line,
+    UTF8Helper::GlyphOffsetAtCodePoint(text, tokenFrom),
+    tokenFrom,
+    tokenLength,
+    color,
+    BackgroundColor,
+    selectionStart,
+    selectionEnd,
+    HighlightColor);
+}
+
 KDRect PythonTextArea::ContentView::dirtyRectFromPosition(const char * position, bool includeFollowingLines) const {
   /* Mark the whole line as dirty.
    * TextArea has a very conservative approach and only dirties the surroundings
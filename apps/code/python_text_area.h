@@ -2,6 +2,7 @@
 #define CODE_PYTHON_TEXT_AREA_H
 
 #include <escher/text_area.h>
+#include "syntax_highlight_cache.h"
 
 namespace Code {
 
@@ -57,7 +58,9 @@ protected:
     void drawLine(KDContext * ctx, int line, const char * text, size_t length, int fromColumn, int toColumn, const char * selectionStart, const char * selectionEnd) const override;
     KDRect dirtyRectFromPosition(const char * position, bool includeFollowingLines) const override;
   private:
+    void drawToken(KDContext * ctx, int line, const char * text, size_t byteLength, const char * tokenFrom, size_t tokenLength, KDColor color, const char ** previousTokenEnd, const char * selectionStart, const char * selectionEnd, const char * autocompleteStart) const;
     App * m_pythonDelegate;
+    mutable SyntaxHighlightCache m_syntaxHighlightCache;
     bool m_autocomplete;
     const char * m_autocompletionEnd;
   };
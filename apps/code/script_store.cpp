@@ -1,4 +1,5 @@
 #include "script_store.h"
+#include <string.h>
 
 namespace Code {
 
@@ -8,7 +9,9 @@ bool ScriptStore::ScriptNameIsFree(const char * baseName) {
   return ScriptBaseNamed(baseName).isNull();
 }
 
-ScriptStore::ScriptStore() {
+ScriptStore::ScriptStore() :
+  m_nextSymbolIndex(0)
+{
   addScriptFromTemplate(ScriptTemplate::Squares());
   addScriptFromTemplate(ScriptTemplate::Parabola());
   addScriptFromTemplate(ScriptTemplate::Mandelbrot());
@@ -52,4 +55,22 @@ void ScriptStore::clearConsoleFetchInformation() {
   }
 }
 
+const ScriptSymbolIndex * ScriptStore::symbolIndexOfScript(Script script) {
+  const char * content = script.content();
+  size_t length = strlen(content);
+  uint32_t checksum = ScriptSymbolIndex::Checksum(content, length);
+  for (int i = 0; i < k_numberOfSymbolIndexes; i++) {
+    if (m_symbolIndexes[i].isValidFor(checksum, length)) {
+      return m_symbolIndexes + i;
+    }
+  }
+  // Replace the oldest index
+  ScriptSymbolIndex * index = m_symbolIndexes + m_nextSymbolIndex;
+  if (!index->indexScript(content, length, checksum)) {
+    return nullptr;
+  }
+  m_nextSymbolIndex = (m_nextSymbolIndex + 1) % k_numberOfSymbolIndexes;
+  return index;
+}
+
 }
@@ -3,6 +3,7 @@
 
 #include <ion.h>
 #include "script.h"
+#include "script_symbol_index.h"
 #include "script_template.h"
 #include <python/port/port.h>
 extern "C" {
@@ -43,6 +44,11 @@ public:
   void clearVariableBoxFetchInformation();
   void clearConsoleFetchInformation();
 
+  /* Return the symbol index of the script, or nullptr if it cannot be parsed.
+   * The indexes of the last scripts read are kept and found again as long as
+   * their content is unchanged, so a script is only parsed again after it has
+   * been edited. Reading another index may replace the returned one. */
+  const ScriptSymbolIndex * symbolIndexOfScript(Script script);
 
 private:
   /* If the storage available space has a smaller size than
@@ -53,9 +59,14 @@ private:
    * (20 char) and 10 char of free space. */
   static constexpr int k_fullFreeSpaceSizeLimit = sizeof(Ion::Storage::record_size_t)+Script::k_defaultScriptNameMaxSize+k_scriptExtensionLength+1+20+10;
 
+  constexpr static int k_numberOfSymbolIndexes = 8;
+
   Ion::Storage::Record::ErrorStatus addScriptFromTemplate(const ScriptTemplate * scriptTemplate) {
     return Script::Create(scriptTemplate->name(), scriptTemplate->content());
   }
+
+  ScriptSymbolIndex m_symbolIndexes[k_numberOfSymbolIndexes];
+  int m_nextSymbolIndex;
 };
 
 }
@@ -0,0 +1,196 @@
+#include "script_symbol_index.h"
+#include <ion.h>
+#include <string.h>
+
+extern "C" {
+#include "py/lexer.h"
+#include "py/nlr.h"
+}
+
+namespace Code {
+
+// Got these in python/py/src/compile.cpp compiled file
+constexpr static uint PN_file_input_2 = 1;
+constexpr static uint PN_funcdef = 3;
+constexpr static uint PN_expr_stmt = 5;
+constexpr static uint PN_import_name = 14; // import math // import math as m // import math, cmath // import math as m, cmath as cm
+constexpr static uint PN_import_from = 15; // from math import * // from math import sin // from math import sin as stew // from math import sin, cos // from math import sin as stew, cos as cabbage // from a.b import *
+constexpr static uint PN_import_as_name = 99; // sin as stew
+constexpr static uint PN_import_as_names = 102; // ... import sin as stew, cos as cabbage
+constexpr static uint PN_dotted_name = 104;
+
+uint32_t ScriptSymbolIndex::Checksum(const char * text, size_t length) {
+  return Ion::crc32Byte(reinterpret_cast<const uint8_t *>(text), length);
+}
+
+bool ScriptSymbolIndex::indexScript(const char * content, size_t length, uint32_t checksum, int firstStatement) {
+  reset(content, length);
+  nlr_buf_t nlr;
+  if (nlr_push(&nlr) != 0) {
+    m_text = nullptr;
+    return false;
+  }
+  mp_lexer_t * lex = mp_lexer_new_from_str_len(0, content, length, false);
+  mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+  mp_parse_node_t pn = parseTree.root;
+
+  if (MP_PARSE_NODE_IS_STRUCT(pn)) {
+    mp_parse_node_struct_t * pns = (mp_parse_node_struct_t *)pn;
+    uint structKind = (uint)MP_PARSE_NODE_STRUCT_KIND(pns);
+    if (structKind == PN_funcdef || structKind == PN_expr_stmt) {
+      // The script is only a single function or variable definition
+      indexDefinition(pns, structKind == PN_funcdef ? Kind::Function : Kind::Variable);
+    } else if (addImport(pns)) {
+      // The script is only an import
+    } else if (structKind == PN_file_input_2) {
+      /* Only the structures at first level (not inside nested scopes) are
+       * function definitions, variables statements or imports of the script. */
+      size_t n = MP_PARSE_NODE_STRUCT_NUM_NODES(pns);
+      for (size_t i = firstStatement; i < n; i++) {
+        mp_parse_node_t child = pns->nodes[i];
+        if (MP_PARSE_NODE_IS_STRUCT(child)) {
+          mp_parse_node_struct_t * childPns = (mp_parse_node_struct_t *)child;
+          structKind = (uint)MP_PARSE_NODE_STRUCT_KIND(childPns);
+          if (structKind == PN_funcdef || structKind == PN_expr_stmt) {
+            indexDefinition(childPns, structKind == PN_funcdef ? Kind::Function : Kind::Variable);
+          } else {
+            addImport(childPns);
+          }
+        }
+        if (m_isFull) {
+          /* The statement was left out: the next index starts with it, unless
+           * it does not fit in an index on its own. */
+          if (i + 1 < n) {
+            m_nextStatement = i == static_cast<size_t>(firstStatement) ? i + 1 : i;
+          }
+          break;
+        }
+      }
+    }
+  }
+  mp_parse_tree_clear(&parseTree);
+  nlr_pop();
+  m_checksum = checksum;
+  m_text = nullptr;
+  m_isValid = true;
+  return true;
+}
+
+bool ScriptSymbolIndex::indexImport(mp_parse_node_struct_t * parseNode, const char * text, size_t length) {
+  reset(text, length);
+  bool isImport = addImport(parseNode);
+  m_text = nullptr;
+  m_isValid = isImport;
+  return isImport;
+}
+
+void ScriptSymbolIndex::reset(const char * text, size_t length) {
+  m_text = text;
+  m_textLength = length;
+  m_nextStatement = 0;
+  m_numberOfSymbols = 0;
+  m_isValid = false;
+  m_isFull = false;
+}
+
+void ScriptSymbolIndex::indexDefinition(mp_parse_node_struct_t * parseNode, Kind kind) {
+  // The first child node is the id which stores the name
+  if (MP_PARSE_NODE_STRUCT_NUM_NODES(parseNode) < 1) {
+    return;
+  }
+  mp_parse_node_t child = parseNode->nodes[0];
+  if (MP_PARSE_NODE_IS_LEAF(child) && MP_PARSE_NODE_LEAF_KIND(child) == MP_PARSE_NODE_ID) {
+    addName(kind, qstr_str(MP_PARSE_NODE_LEAF_ARG(child)));
+  }
+}
+
+bool ScriptSymbolIndex::addImport(mp_parse_node_struct_t * parseNode) {
+  uint structKind = (uint)MP_PARSE_NODE_STRUCT_KIND(parseNode);
+  bool structKindIsImportWithoutFrom = structKind == PN_import_name;
+  if (!structKindIsImportWithoutFrom
+      && structKind != PN_import_from
+      && structKind != PN_import_as_names
+      && structKind != PN_import_as_name)
+  {
+    // This was not an import structure
+    return false;
+  }
+  int structureIndex = m_numberOfSymbols;
+  add(Symbol(structKindIsImportWithoutFrom ? Kind::ImportAll : Kind::Import));
+  bool importsAll = structKindIsImportWithoutFrom;
+  size_t childNodesCount = MP_PARSE_NODE_STRUCT_NUM_NODES(parseNode);
+  for (size_t i = 0; i < childNodesCount; i++) {
+    mp_parse_node_t child = parseNode->nodes[i];
+    if (MP_PARSE_NODE_IS_LEAF(child) && MP_PARSE_NODE_LEAF_KIND(child) == MP_PARSE_NODE_ID) {
+      // Parsing something like "import xyz"
+      addName(Kind::ImportedName, qstr_str(MP_PARSE_NODE_LEAF_ARG(child)));
+    } else if (MP_PARSE_NODE_IS_STRUCT(child)) {
+      // Parsing something like "from math import sin"
+      addImport((mp_parse_node_struct_t *)child);
+    } else if (MP_PARSE_NODE_IS_TOKEN(child) && MP_PARSE_NODE_IS_TOKEN_KIND(child, MP_TOKEN_OP_STAR)) {
+      // Parsing something like "from math import *"
+      add(Symbol(Kind::Star));
+      importsAll = true;
+    }
+  }
+  if (importsAll) {
+    assert(childNodesCount > 0);
+    addSource(parseNode->nodes[0]);
+  }
+  if (m_isFull) {
+    // Leave the whole structure out
+    m_numberOfSymbols = structureIndex;
+  } else {
+    m_symbols[structureIndex].m_length = m_numberOfSymbols - structureIndex - 1;
+  }
+  return true;
+}
+
+void ScriptSymbolIndex::addSource(mp_parse_node_t node) {
+  if (MP_PARSE_NODE_IS_LEAF(node) && MP_PARSE_NODE_LEAF_KIND(node) == MP_PARSE_NODE_ID) {
+    // The importation source is "simple", for instance: from math import *
+    addName(Kind::Source, qstr_str(MP_PARSE_NODE_LEAF_ARG(node)));
+    return;
+  }
+  if (!MP_PARSE_NODE_IS_STRUCT(node)) {
+    return;
+  }
+  mp_parse_node_struct_t * nodePNS = (mp_parse_node_struct_t *)node;
+  /* The importation source is "complex", for instance:
+   * from matplotlib.pyplot import *
+   * The only dotted name we might want to find is matplolib.pyplot, so we do a
+   * very specific search. */
+  if (MP_PARSE_NODE_STRUCT_KIND(nodePNS) == PN_dotted_name
+      && MP_PARSE_NODE_STRUCT_NUM_NODES(nodePNS) == 2
+      && MP_PARSE_NODE_LEAF_ARG(nodePNS->nodes[0]) == MP_QSTR_matplotlib
+      && MP_PARSE_NODE_LEAF_ARG(nodePNS->nodes[1]) == MP_QSTR_pyplot)
+  {
+    add(Symbol(Kind::PyplotSource));
+  }
+}
+
+void ScriptSymbolIndex::addName(Kind kind, const char * name) {
+  /* The parse tree only holds qstrs: find the name in the text to store its
+   * offset. Any occurrence will do. */
+  size_t nameLength = strlen(name);
+  if (nameLength == 0 || nameLength > UINT8_MAX || nameLength > m_textLength) {
+    return;
+  }
+  for (size_t offset = 0; offset <= m_textLength - nameLength; offset++) {
+    if (memcmp(m_text + offset, name, nameLength) == 0) {
+      add(Symbol(kind, offset, nameLength));
+      return;
+    }
+  }
+  assert(false);
+}
+
+void ScriptSymbolIndex::add(Symbol symbol) {
+  if (m_numberOfSymbols >= k_maxNumberOfSymbols) {
+    m_isFull = true;
+    return;
+  }
+  m_symbols[m_numberOfSymbols++] = symbol;
+}
+
+}
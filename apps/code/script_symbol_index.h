@@ -0,0 +1,105 @@
+#ifndef CODE_SCRIPT_SYMBOL_INDEX_H
+#define CODE_SCRIPT_SYMBOL_INDEX_H
+
+#include <ion/storage.h>
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+extern "C" {
+#include "py/parse.h"
+}
+
+namespace Code {
+
+/* A ScriptSymbolIndex lists the top-level function definitions, variables and
+ * imports of a script, in the order in which they appear in its parse tree.
+ * The variable box reads the names an imported script provides from its index
+ * instead of parsing it again. Resolving the imports depends on the other
+ * scripts, so they are recorded as written and resolved when the index is
+ * read.
+ * Names are stored as offsets in the indexed text. An import structure is a
+ * symbol of kind Import or ImportAll followed by length() symbols: the imported
+ * names, nested structures and stars, then the source if the structure can
+ * import all of it.
+ * When the symbols of a script do not all fit, the index stops before a
+ * top-level statement, and the rest of the script is indexed again from this
+ * statement on. */
+
+class ScriptSymbolIndex {
+public:
+  enum class Kind : uint8_t {
+    Function,
+    Variable,
+    Import, // "from math import sin"
+    ImportAll, // "import math"
+    ImportedName,
+    Star,
+    Source,
+    PyplotSource // "matplotlib.pyplot", which is not a single name in the text
+  };
+
+  class Symbol {
+  public:
+    Symbol(Kind kind = Kind::Function, uint16_t offset = 0, uint8_t length = 0) :
+      m_offset(offset),
+      m_length(length),
+      m_kind(kind)
+    {}
+    Kind kind() const { return m_kind; }
+    uint16_t offset() const { return m_offset; }
+    uint8_t length() const { return m_length; }
+  private:
+    friend class ScriptSymbolIndex;
+    uint16_t m_offset;
+    uint8_t m_length;
+    Kind m_kind;
+  };
+  static_assert(Ion::Storage::k_storageSize <= UINT16_MAX, "Symbol offsets cannot address a script");
+
+  /* Enough symbols for most scripts. A single import structure which does not
+   * fit is left out. */
+  constexpr static int k_maxNumberOfSymbols = 48;
+
+  static uint32_t Checksum(const char * text, size_t length);
+
+  ScriptSymbolIndex() : m_checksum(0), m_textLength(0), m_nextStatement(0), m_numberOfSymbols(0), m_isValid(false) {}
+  bool isValidFor(uint32_t checksum, size_t textLength) const { return m_isValid && m_checksum == checksum && m_textLength == textLength; }
+  int numberOfSymbols() const { return m_numberOfSymbols; }
+  const Symbol * symbolAtIndex(int index) const {
+    assert(index >= 0 && index < m_numberOfSymbols);
+    return m_symbols + index;
+  }
+
+  /* Parse a whole script and index its top-level statements from
+   * firstStatement on. This requires the MicroPython environment. Returns
+   * false if parsing raised, in which case the index stays invalid. */
+  bool indexScript(const char * content, size_t length, uint32_t checksum, int firstStatement = 0);
+  /* The statement the symbols which did not fit start at, or 0 if the index
+   * holds the whole script. */
+  int nextStatement() const { return m_nextStatement; }
+  /* Index the import structures of the parse tree of a single statement of
+   * text. Returns false if the node is not an import structure. */
+  bool indexImport(mp_parse_node_struct_t * parseNode, const char * text, size_t length);
+
+private:
+  void reset(const char * text, size_t length);
+  void indexDefinition(mp_parse_node_struct_t * parseNode, Kind kind);
+  bool addImport(mp_parse_node_struct_t * parseNode);
+  void addSource(mp_parse_node_t node);
+  void addName(Kind kind, const char * name);
+  void add(Symbol symbol);
+
+  uint32_t m_checksum;
+  uint16_t m_textLength;
+  uint16_t m_nextStatement;
+  uint8_t m_numberOfSymbols;
+  bool m_isValid;
+  bool m_isFull;
+  // Only set while indexing
+  const char * m_text;
+  Symbol m_symbols[k_maxNumberOfSymbols];
+};
+
+}
+
+#endif
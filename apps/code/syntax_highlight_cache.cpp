@@ -0,0 +1,49 @@
+#include "syntax_highlight_cache.h"
+#include <assert.h>
+#include <string.h>
+
+namespace Code {
+
+void SyntaxHighlightCache::clear() {
+  for (int i = 0; i < k_numberOfLines; i++) {
+    m_lines[i].numberOfSpans = UINT8_MAX;
+  }
+}
+
+const SyntaxHighlightCache::Span * SyntaxHighlightCache::spans(const char * text, size_t length, int * numberOfSpans) const {
+  if (length > k_maxLineLength) {
+    return nullptr;
+  }
+  uint32_t hash = Hash(text, length);
+  const Line * line = m_lines + hash % k_numberOfLines;
+  if (line->numberOfSpans == UINT8_MAX || line->hash != hash || line->length != length || memcmp(line->text, text, length) != 0) {
+    return nullptr;
+  }
+  *numberOfSpans = line->numberOfSpans;
+  return line->spans;
+}
+
+void SyntaxHighlightCache::store(const char * text, size_t length, const Span * spans, int numberOfSpans) {
+  if (length > k_maxLineLength || numberOfSpans > k_maxNumberOfSpans) {
+    return;
+  }
+  uint32_t hash = Hash(text, length);
+  // Direct mapping: the line replaces the one with the same index
+  Line * line = m_lines + hash % k_numberOfLines;
+  line->hash = hash;
+  line->length = length;
+  line->numberOfSpans = numberOfSpans;
+  memcpy(line->text, text, length);
+  memcpy(line->spans, spans, numberOfSpans * sizeof(Span));
+}
+
+uint32_t SyntaxHighlightCache::Hash(const char * text, size_t length) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<uint8_t>(text[i])) * 16777619u;
+  }
+  return hash;
+}
+
+}
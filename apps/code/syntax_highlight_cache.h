@@ -0,0 +1,51 @@
+#ifndef CODE_SYNTAX_HIGHLIGHT_CACHE_H
+#define CODE_SYNTAX_HIGHLIGHT_CACHE_H
+
+#include <kandinsky/color.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Code {
+
+/* The editor lexes each line independently to color it. Lexing needs the
+ * MicroPython heap and is much slower than drawing, so the colored spans of
+ * the last drawn lines are kept with their text, indexed by a hash of it.
+ * Lines moved by an edit or scrolled back into view are found again, and a
+ * modified line just misses the cache: there is nothing to invalidate. */
+
+class SyntaxHighlightCache {
+public:
+  struct Span {
+    uint8_t start; // In bytes, from the beginning of the line
+    uint8_t length;
+    KDColor color;
+  };
+  static constexpr int k_numberOfLines = 16;
+  static constexpr int k_maxNumberOfSpans = 20;
+  /* The text of the lines is stored to tell apart lines with the same hash.
+   * Longer lines are rare in scripts and are lexed each time. */
+  static constexpr size_t k_maxLineLength = 80;
+
+  SyntaxHighlightCache() { clear(); }
+  void clear();
+  /* Return the spans of the line of text, or nullptr if it is not in the
+   * cache. */
+  const Span * spans(const char * text, size_t length, int * numberOfSpans) const;
+  // Lines which are too long or have too many spans are not stored
+  void store(const char * text, size_t length, const Span * spans, int numberOfSpans);
+
+private:
+  struct Line {
+    uint32_t hash;
+    uint8_t length;
+    uint8_t numberOfSpans; // UINT8_MAX for an empty entry
+    Span spans[k_maxNumberOfSpans];
+    char text[k_maxLineLength];
+  };
+  static uint32_t Hash(const char * text, size_t length);
+  Line m_lines[k_numberOfLines];
+};
+
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include <quiz.h>
 #include "../clipboard.h"
+#include <python/port/port.h>
 #include <string.h>
 #include <poincare/expression.h>
 
@@ -8,6 +9,8 @@ using namespace Poincare;
 
 namespace Code {
 
+static char sPythonHeap[8192];
+
 void assert_clipboard_enters_and_exits_python(const char * string, const char * stringResult) {
   Clipboard * clipboard = Clipboard::sharedClipboard();
   clipboard->store(string);
@@ -18,6 +21,8 @@ void assert_clipboard_enters_and_exits_python(const char * string, const char *
 }
 
 QUIZ_CASE(code_clipboard_enters_and_exits_python) {
+  // Translating the text relies on the MicroPython lexer
+  MicroPython::init(sPythonHeap, sPythonHeap + sizeof(sPythonHeap));
   assert_clipboard_enters_and_exits_python("4×4", "4*4");
   assert_clipboard_enters_and_exits_python("ℯ^\u00121+2\u0013", "exp\u00121+2\u0013");
   assert_clipboard_enters_and_exits_python("ℯ^(ln(4))", "exp(log(4))");
@@ -47,6 +52,8 @@ QUIZ_CASE(code_clipboard_enters_and_exits_python) {
   assert_clipboard_enters_and_exits_python(
       "e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+\ne+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+\ne+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+\ne+1e2+e+1e2+e+1e2+e+1e2+e+1e2+exec()",
       "e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+\ne+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+\ne+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+e+1e2+\ne+1e2+e+1e2+e+1e2+e+1e2+e+1e2+exec()");
+
+  MicroPython::deinit();
 }
 
 }
@@ -0,0 +1,114 @@
+#include <quiz.h>
+#include "../script_store.h"
+#include "../script_symbol_index.h"
+#include <python/port/port.h>
+#include <string.h>
+
+namespace Code {
+
+static char sPythonHeap[8192];
+
+static void assert_symbol_is(const ScriptSymbolIndex & index, int i, const char * text, ScriptSymbolIndex::Kind kind, const char * name = nullptr, int length = 0) {
+  quiz_assert(i < index.numberOfSymbols());
+  const ScriptSymbolIndex::Symbol * symbol = index.symbolAtIndex(i);
+  quiz_assert(symbol->kind() == kind);
+  if (name != nullptr) {
+    quiz_assert(symbol->length() == strlen(name));
+    quiz_assert(strncmp(text + symbol->offset(), name, symbol->length()) == 0);
+  } else {
+    quiz_assert(symbol->length() == length);
+  }
+}
+
+QUIZ_CASE(code_script_symbol_index) {
+  MicroPython::init(sPythonHeap, sPythonHeap + sizeof(sPythonHeap));
+  const char * script =
+    "from math import *\n"
+    "import turtle\n"
+    "def fun(x):\n"
+    "  local = 2\n"
+    "  return x\n"
+    "a = 3\n"
+    "from matplotlib.pyplot import *\n"
+    "from random import randint as r\n";
+  size_t length = strlen(script);
+  uint32_t checksum = ScriptSymbolIndex::Checksum(script, length);
+  ScriptSymbolIndex index;
+  quiz_assert(!index.isValidFor(checksum, length));
+  quiz_assert(index.indexScript(script, length, checksum));
+  quiz_assert(index.isValidFor(checksum, length));
+  quiz_assert(!index.isValidFor(checksum + 1, length));
+
+  typedef ScriptSymbolIndex::Kind Kind;
+  int i = 0;
+  assert_symbol_is(index, i++, script, Kind::Import, nullptr, 3);
+  assert_symbol_is(index, i++, script, Kind::ImportedName, "math");
+  assert_symbol_is(index, i++, script, Kind::Star);
+  assert_symbol_is(index, i++, script, Kind::Source, "math");
+  assert_symbol_is(index, i++, script, Kind::ImportAll, nullptr, 2);
+  assert_symbol_is(index, i++, script, Kind::ImportedName, "turtle");
+  assert_symbol_is(index, i++, script, Kind::Source, "turtle");
+  // Only the first level is indexed
+  assert_symbol_is(index, i++, script, Kind::Function, "fun");
+  assert_symbol_is(index, i++, script, Kind::Variable, "a");
+  assert_symbol_is(index, i++, script, Kind::Import, nullptr, 2);
+  assert_symbol_is(index, i++, script, Kind::Star);
+  assert_symbol_is(index, i++, script, Kind::PyplotSource);
+  assert_symbol_is(index, i++, script, Kind::Import, nullptr, 4);
+  assert_symbol_is(index, i++, script, Kind::ImportedName, "random");
+  assert_symbol_is(index, i++, script, Kind::Import, nullptr, 2);
+  assert_symbol_is(index, i++, script, Kind::ImportedName, "randint");
+  assert_symbol_is(index, i++, script, Kind::ImportedName, "r");
+  quiz_assert(index.numberOfSymbols() == i);
+
+  // A script which does not parse is not indexed
+  const char * invalidScript = "def f(:\n";
+  length = strlen(invalidScript);
+  quiz_assert(!index.indexScript(invalidScript, length, ScriptSymbolIndex::Checksum(invalidScript, length)));
+
+  // The statements which do not fit are indexed from the first one left out
+  constexpr int bufferSize = 20 * ScriptSymbolIndex::k_maxNumberOfSymbols;
+  char longScript[bufferSize];
+  char * c = longScript;
+  for (int j = 0; j < ScriptSymbolIndex::k_maxNumberOfSymbols - 1; j++) {
+    c += strlcpy(c, "v=1\n", longScript + bufferSize - c);
+  }
+  c += strlcpy(c, "import turtle\nw=2\n", longScript + bufferSize - c);
+  length = c - longScript;
+  checksum = ScriptSymbolIndex::Checksum(longScript, length);
+  quiz_assert(index.indexScript(longScript, length, checksum));
+  quiz_assert(index.numberOfSymbols() == ScriptSymbolIndex::k_maxNumberOfSymbols - 1);
+  assert_symbol_is(index, index.numberOfSymbols() - 1, longScript, Kind::Variable, "v");
+  int nextStatement = index.nextStatement();
+  quiz_assert(nextStatement == ScriptSymbolIndex::k_maxNumberOfSymbols - 1);
+  quiz_assert(index.indexScript(longScript, length, checksum, nextStatement));
+  quiz_assert(index.nextStatement() == 0);
+  i = 0;
+  assert_symbol_is(index, i++, longScript, Kind::ImportAll, nullptr, 2);
+  assert_symbol_is(index, i++, longScript, Kind::ImportedName, "turtle");
+  assert_symbol_is(index, i++, longScript, Kind::Source, "turtle");
+  assert_symbol_is(index, i++, longScript, Kind::Variable, "w");
+  quiz_assert(index.numberOfSymbols() == i);
+
+  MicroPython::deinit();
+}
+
+QUIZ_CASE(code_script_store_symbol_indexes) {
+  MicroPython::init(sPythonHeap, sPythonHeap + sizeof(sPythonHeap));
+  ScriptStore store;
+  store.deleteAllScripts();
+  store.addNewScript();
+  Script script = store.scriptAtIndex(0);
+  const ScriptSymbolIndex * index = store.symbolIndexOfScript(script);
+  quiz_assert(index != nullptr && index->numberOfSymbols() > 0);
+  // The index is found again until the script is edited
+  quiz_assert(store.symbolIndexOfScript(script) == index);
+  char * content = const_cast<char *>(script.content());
+  content[0] = '#';
+  index = store.symbolIndexOfScript(script);
+  quiz_assert(index != nullptr && index->numberOfSymbols() == 0);
+  store.deleteAllScripts();
+  MicroPython::deinit();
+}
+
+}
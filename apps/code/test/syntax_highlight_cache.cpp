@@ -0,0 +1,45 @@
+#include <quiz.h>
+#include "../syntax_highlight_cache.h"
+#include <string.h>
+
+namespace Code {
+
+static SyntaxHighlightCache::Span sSpans[] = {
+  {4, 6, KDColorRed},
+  {11, 1, KDColorBlue},
+};
+
+QUIZ_CASE(code_syntax_highlight_cache) {
+  SyntaxHighlightCache cache;
+  const char * line = "    return 1";
+  int numberOfSpans = 0;
+  quiz_assert(cache.spans(line, strlen(line), &numberOfSpans) == nullptr);
+  cache.store(line, strlen(line), sSpans, 2);
+
+  // Lines are found by content, wherever they are in the script
+  char movedLine[] = "    return 1";
+  const SyntaxHighlightCache::Span * spans = cache.spans(movedLine, strlen(movedLine), &numberOfSpans);
+  quiz_assert(spans != nullptr && numberOfSpans == 2);
+  quiz_assert(spans[0].start == 4 && spans[0].length == 6 && spans[0].color == KDColorRed);
+  quiz_assert(spans[1].start == 11 && spans[1].color == KDColorBlue);
+
+  // An edited line misses
+  movedLine[11] = '2';
+  quiz_assert(cache.spans(movedLine, strlen(movedLine), &numberOfSpans) == nullptr);
+  quiz_assert(cache.spans(line, strlen(line) - 1, &numberOfSpans) == nullptr);
+
+  // Lines with the same hash are told apart by their text
+  const char * collidingLines[] = {"a = BjPUKiF7", "a = m6kHvZcy"};
+  cache.store(collidingLines[0], strlen(collidingLines[0]), sSpans, 1);
+  quiz_assert(cache.spans(collidingLines[1], strlen(collidingLines[1]), &numberOfSpans) == nullptr);
+  quiz_assert(cache.spans(collidingLines[0], strlen(collidingLines[0]), &numberOfSpans) != nullptr && numberOfSpans == 1);
+
+  // Lines without spans are cached too
+  cache.store("", 0, sSpans, 0);
+  quiz_assert(cache.spans("", 0, &numberOfSpans) != nullptr && numberOfSpans == 0);
+
+  cache.clear();
+  quiz_assert(cache.spans(line, strlen(line), &numberOfSpans) == nullptr);
+}
+
+}
@@ -1,10 +1,13 @@
 #include <quiz.h>
 #include "../script_store.h"
 #include "../variable_box_controller.h"
+#include <python/port/port.h>
 #include <string.h>
 
 using namespace Code;
 
+static char sPythonHeap[8192];
+
 void assert_variables_are(const char * script, const size_t nameToCompleteOffsetInScript, const size_t nameToCompleteLength, const char * * expectedVariables, int expectedVariablesCount) {
   // Clean the store
   ScriptStore store;
@@ -61,6 +64,7 @@ QUIZ_CASE(variable_box_controller) {
     "from",
     "frozenset()"
   };
+  MicroPython::init(sPythonHeap, sPythonHeap + sizeof(sPythonHeap));
   // FIXME This test does not load imported variables for now
   assert_variables_are(
       "\x01 from math import *\nfroo=3",
@@ -68,4 +72,5 @@ QUIZ_CASE(variable_box_controller) {
       2,
       expectedVariables,
       sizeof(expectedVariables) / sizeof(const char *));
+  MicroPython::deinit();
 }
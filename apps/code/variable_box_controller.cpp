@@ -21,23 +21,6 @@ using namespace Escher;
 
 namespace Code {
 
-// Got these in python/py/src/compile.cpp compiled file
-constexpr static uint PN_file_input_2 = 1;
-constexpr static uint PN_funcdef = 3;
-constexpr static uint PN_expr_stmt = 5;
-constexpr static uint PN_import_name = 14; // import math // import math as m // import math, cmath // import math as m, cmath as cm
-constexpr static uint PN_import_from = 15; // from math import * // from math import sin // from math import sin as stew // from math import sin, cos // from math import sin as stew, cos as cabbage // from a.b import *
-constexpr static uint PN_import_as_name = 99; // sin as stew
-constexpr static uint PN_import_as_names = 102; // ... import sin as stew, cos as cabbage
-constexpr static uint PN_dotted_name = 104;
-/* These are not used for now but might be relevant at some point?
-constexpr static uint PN_import_stmt = 92;
-constexpr static uint PN_import_from_2 = 93;
-constexpr static uint PN_import_from_2b = 94; // "from .foo import"
-constexpr static uint PN_import_from_3 = 95;
-constexpr static uint PN_import_as_names_paren = 96;
-*/
-
 VariableBoxController::VariableBoxController(ScriptStore * scriptStore) :
   AlternateEmptyNestedMenuController(I18n::Message::FunctionsAndVariables),
   m_scriptStore(scriptStore)
@@ -542,11 +525,7 @@ void VariableBoxController::loadImportedVariablesInScript(const char * scriptCon
     while (parseStart != parseEnd) {
       mp_lexer_t *lex = mp_lexer_new_from_str_len(0, parseStart, parseEnd - parseStart, 0);
       mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_SINGLE_INPUT);
-      mp_parse_node_t pn = parseTree.root;
-
-      if (MP_PARSE_NODE_IS_STRUCT(pn)) {
-        addNodesFromImportMaybe((mp_parse_node_struct_t *) pn, textToAutocomplete, textToAutocompleteLength);
-      }
+      loadImportsInStatement(parseTree.root, parseStart, parseEnd - parseStart, textToAutocomplete, textToAutocompleteLength);
 
       mp_parse_tree_clear(&parseTree);
 
@@ -579,10 +558,7 @@ void VariableBoxController::loadImportedVariablesInScript(const char * scriptCon
     }
     mp_lexer_t *lex = mp_lexer_new_from_str_len(0, parseStart, textToAutocomplete + textToAutocompleteLength - parseStart, 0);
     mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_SINGLE_INPUT);
-    mp_parse_node_t pn = parseTree.root;
-    if (MP_PARSE_NODE_IS_STRUCT(pn)) {
-        addNodesFromImportMaybe((mp_parse_node_struct_t *) pn, textToAutocomplete, textToAutocompleteLength);
-    }
+    loadImportsInStatement(parseTree.root, parseStart, textToAutocomplete + textToAutocompleteLength - parseStart, textToAutocomplete, textToAutocompleteLength);
     nlr_pop();
   }
 }
@@ -646,75 +622,81 @@ void VariableBoxController::loadGlobalAndImportedVariablesInScriptAsImported(Scr
     // We already fetched these script variables
     return;
   }
+  // Mark that we fetch these script variables, in case they import each other
+  script.setFetchedForVariableBox(true);
   nlr_buf_t nlr;
   if (nlr_push(&nlr) == 0) {
-    const char * scriptName = script.fullName();
-    const char * scriptContent = script.content();
-    mp_lexer_t *lex = mp_lexer_new_from_str_len(0, scriptContent, strlen(scriptContent), false);
-    mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_FILE_INPUT);
-    mp_parse_node_t pn = parseTree.root;
-
-    if (MP_PARSE_NODE_IS_STRUCT(pn)) {
-      mp_parse_node_struct_t * pns = (mp_parse_node_struct_t *)pn;
-      uint structKind = (uint)MP_PARSE_NODE_STRUCT_KIND(pns);
-      if (structKind == PN_funcdef || structKind == PN_expr_stmt) {
-        // The script is only a single function or variable definition
-        addImportStructFromScript(pns, structKind, scriptName, textToAutocomplete, textToAutocompleteLength);
-      } else if (addNodesFromImportMaybe(pns, textToAutocomplete, textToAutocompleteLength, importFromModules)) {
-        // The script is is only an import, handled in addNodesFromImportMaybe
-      } else if (structKind == PN_file_input_2) {
-        /* At this point, if the script node is not of type "file_input_2", it
-         * will not have main structures of the wanted type.
-         * We look for structures at first level (not inside nested scopes) that
-         * are either function definitions, variables statements or imports. */
-        size_t n = MP_PARSE_NODE_STRUCT_NUM_NODES(pns);
-        for (size_t i = 0; i < n; i++) {
-          mp_parse_node_t child = pns->nodes[i];
-          if (MP_PARSE_NODE_IS_STRUCT(child)) {
-            mp_parse_node_struct_t *child_pns = (mp_parse_node_struct_t*)(child);
-            structKind = (uint)MP_PARSE_NODE_STRUCT_KIND(child_pns);
-            if (structKind == PN_funcdef || structKind == PN_expr_stmt) {
-              if (addImportStructFromScript(child_pns, structKind, scriptName, textToAutocomplete, textToAutocompleteLength)) {
-                break;
-              }
-            } else {
-              addNodesFromImportMaybe(child_pns, textToAutocomplete, textToAutocompleteLength, importFromModules);
-            }
-          }
+    const ScriptSymbolIndex * storedIndex = m_scriptStore->symbolIndexOfScript(script);
+    if (storedIndex != nullptr) {
+      /* Loading the scripts it imports reads other indexes, which may replace
+       * this one in the store. */
+      ScriptSymbolIndex index = *storedIndex;
+      const char * content = script.content();
+      loadSymbols(&index, content, script.fullName(), textToAutocomplete, textToAutocompleteLength, importFromModules);
+      /* The symbols which did not fit in the stored index are read from the
+       * parse tree again, an index at a time. */
+      while (index.nextStatement() > 0 && m_nodesCount < k_maxScriptNodesCount) {
+        size_t length = strlen(content);
+        if (!index.indexScript(content, length, ScriptSymbolIndex::Checksum(content, length), index.nextStatement())) {
+          break;
         }
+        loadSymbols(&index, content, script.fullName(), textToAutocomplete, textToAutocompleteLength, importFromModules);
       }
     }
-    mp_parse_tree_clear(&parseTree);
     nlr_pop();
   }
-  // Mark that we already fetched these script variables
-  script.setFetchedForVariableBox(true);
 }
 
-bool VariableBoxController::addNodesFromImportMaybe(mp_parse_node_struct_t * parseNode, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules) {
-  // Determine if the node is an import structure
-  uint structKind = (uint) MP_PARSE_NODE_STRUCT_KIND(parseNode);
-  bool structKindIsImportWithoutFrom = structKind == PN_import_name;
-  if (!structKindIsImportWithoutFrom
-      && structKind != PN_import_from
-      && structKind != PN_import_as_names
-      && structKind != PN_import_as_name)
-  {
-    // This was not an import structure
-    return false;
+void VariableBoxController::loadImportsInStatement(mp_parse_node_t parseNode, const char * text, size_t length, const char * textToAutocomplete, int textToAutocompleteLength) {
+  ScriptSymbolIndex index;
+  if (MP_PARSE_NODE_IS_STRUCT(parseNode) && index.indexImport((mp_parse_node_struct_t *)parseNode, text, length)) {
+    loadSymbols(&index, text, nullptr, textToAutocomplete, textToAutocompleteLength);
+  }
+}
+
+void VariableBoxController::loadSymbols(const ScriptSymbolIndex * index, const char * text, const char * scriptName, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules) {
+  const int numberOfSymbols = index->numberOfSymbols();
+  for (int i = 0; i < numberOfSymbols; i++) {
+    const ScriptSymbolIndex::Symbol * symbol = index->symbolAtIndex(i);
+    switch (symbol->kind()) {
+      case ScriptSymbolIndex::Kind::Function:
+      case ScriptSymbolIndex::Kind::Variable:
+        assert(scriptName != nullptr);
+        if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength, symbol->kind() == ScriptSymbolIndex::Kind::Function ? ScriptNode::Type::WithParentheses : ScriptNode::Type::WithoutParentheses, k_importedOrigin, SymbolName(text, symbol), -1, scriptName)) {
+          return;
+        }
+        break;
+      case ScriptSymbolIndex::Kind::Import:
+      case ScriptSymbolIndex::Kind::ImportAll:
+        loadImportedSymbols(index, i, text, textToAutocomplete, textToAutocompleteLength, importFromModules);
+        i += symbol->length();
+        break;
+      default:
+        // Other symbols belong to import structures
+        assert(false);
+    }
   }
+}
 
+const char * VariableBoxController::SymbolName(const char * text, const ScriptSymbolIndex::Symbol * symbol) {
+  /* Intern the name: the lookups need a null-terminated string and the nodes
+   * keep the source names. */
+  return qstr_str(qstr_from_strn(text + symbol->offset(), symbol->length()));
+}
+
+void VariableBoxController::loadImportedSymbols(const ScriptSymbolIndex * index, int structureIndex, const char * text, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules) {
+  const ScriptSymbolIndex::Symbol * structure = index->symbolAtIndex(structureIndex);
   /* loadAllSourceContent will be True if the struct imports all the content
    * from a script / module (for instance, "import math"), instead of single
    * items (for instance, "from math import sin"). */
-  bool loadAllSourceContent = structKindIsImportWithoutFrom;
+  bool loadAllSourceContent = structure->kind() == ScriptSymbolIndex::Kind::ImportAll;
+  const int structureEnd = structureIndex + 1 + structure->length();
 
-  size_t childNodesCount = MP_PARSE_NODE_STRUCT_NUM_NODES(parseNode);
-  for (size_t i = 0; i < childNodesCount; i++) {
-    mp_parse_node_t child = parseNode->nodes[i];
-    if (MP_PARSE_NODE_IS_LEAF(child) && MP_PARSE_NODE_LEAF_KIND(child) == MP_PARSE_NODE_ID) {
+  for (int i = structureIndex + 1; i < structureEnd; i++) {
+    const ScriptSymbolIndex::Symbol * symbol = index->symbolAtIndex(i);
+    if (symbol->kind() == ScriptSymbolIndex::Kind::ImportedName) {
       // Parsing something like "import xyz"
-      const char * id = qstr_str(MP_PARSE_NODE_LEAF_ARG(child));
+      const char * id = SymbolName(text, symbol);
 
       /* xyz might be:
        *  - a module name -> in which case we want no importation source on the
@@ -724,7 +706,7 @@ bool VariableBoxController::addNodesFromImportMaybe(mp_parse_node_struct_t * par
       const char * sourceId = nullptr;
       if (importationSourceIsModule(id)) {
         if (!importFromModules) {
-          return true;
+          return;
         }
       } else {
         /*  If a module and a script have the same name, the micropython
@@ -736,7 +718,7 @@ bool VariableBoxController::addNodesFromImportMaybe(mp_parse_node_struct_t * par
            * sourceId. We also use it to make sure, if importFromModules is
            * false, that we are not importing variables from something else than
            * scripts. */
-          return true;
+          return;
         }
       }
       /* FIXME : When parsing something like "from math import sin", sin is here
@@ -748,10 +730,11 @@ bool VariableBoxController::addNodesFromImportMaybe(mp_parse_node_struct_t * par
       if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength, ScriptNode::Type::WithoutParentheses, k_importedOrigin, id, -1, source)) {
         break;
       }
-    } else if (MP_PARSE_NODE_IS_STRUCT(child)) {
+    } else if (symbol->kind() == ScriptSymbolIndex::Kind::Import || symbol->kind() == ScriptSymbolIndex::Kind::ImportAll) {
       // Parsing something like "from math import sin"
-      addNodesFromImportMaybe((mp_parse_node_struct_t *)child, textToAutocomplete, textToAutocompleteLength, importFromModules);
-    } else if (MP_PARSE_NODE_IS_TOKEN(child) && MP_PARSE_NODE_IS_TOKEN_KIND(child, MP_TOKEN_OP_STAR)) {
+      loadImportedSymbols(index, i, text, textToAutocomplete, textToAutocompleteLength, importFromModules);
+      i += symbol->length();
+    } else if (symbol->kind() == ScriptSymbolIndex::Kind::Star) {
       /* Parsing something like "from math import *"
        * -> Load all the module content */
       loadAllSourceContent = true;
@@ -759,78 +742,50 @@ bool VariableBoxController::addNodesFromImportMaybe(mp_parse_node_struct_t * par
   }
 
   // Fetch a script / module content if needed
-  if (loadAllSourceContent) {
-    assert(childNodesCount > 0);
-    const char * importationSourceName = importationSourceNameFromNode(parseNode->nodes[0]);
-    if (importationSourceName == nullptr) {
-      // For instance, the name is a "dotted name" but not matplotlib.pyplot
-      return true;
+  if (!loadAllSourceContent) {
+    return;
+  }
+  // The source, if any, ends the structure
+  const ScriptSymbolIndex::Symbol * source = index->symbolAtIndex(structureEnd - 1);
+  const char * importationSourceName;
+  if (source->kind() == ScriptSymbolIndex::Kind::Source) {
+    importationSourceName = SymbolName(text, source);
+  } else if (source->kind() == ScriptSymbolIndex::Kind::PyplotSource) {
+    importationSourceName = qstr_str(MP_QSTR_matplotlib_dot_pyplot);
+  } else {
+    // For instance, the name is a "dotted name" but not matplotlib.pyplot
+    return;
+  }
+  int numberOfModuleChildren = 0;
+  const ToolboxMessageTree * moduleChildren = nullptr;
+  if (importationSourceIsModule(importationSourceName, &moduleChildren, &numberOfModuleChildren)) {
+    if (!importFromModules) {
+      return;
     }
-    int numberOfModuleChildren = 0;
-    const ToolboxMessageTree * moduleChildren = nullptr;
-    if (importationSourceIsModule(importationSourceName, &moduleChildren, &numberOfModuleChildren)) {
-      if (!importFromModules) {
-        return true;
-      }
-      if (moduleChildren != nullptr) {
-        /* The importation source is a module that we display in the toolbox:
-         * get the nodes from the toolbox
-         * We skip the 3 first nodes, which are "import ...", "from ... import *"
-         * and "....function". */
-        constexpr int numberOfNodesToSkip = 3;
-        assert(numberOfModuleChildren > numberOfNodesToSkip);
-        for (int i = numberOfNodesToSkip; i < numberOfModuleChildren; i++) {
-          const char * name = I18n::translate((moduleChildren + i)->label());
-          if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength, ScriptNode::Type::WithoutParentheses, k_importedOrigin, name, -1, importationSourceName, I18n::translate((moduleChildren + i)->text()))) {
-            break;
-          }
+    if (moduleChildren != nullptr) {
+      /* The importation source is a module that we display in the toolbox:
+       * get the nodes from the toolbox
+       * We skip the 3 first nodes, which are "import ...", "from ... import *"
+       * and "....function". */
+      constexpr int numberOfNodesToSkip = 3;
+      assert(numberOfModuleChildren > numberOfNodesToSkip);
+      for (int i = numberOfNodesToSkip; i < numberOfModuleChildren; i++) {
+        const char * name = I18n::translate((moduleChildren + i)->label());
+        if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength, ScriptNode::Type::WithoutParentheses, k_importedOrigin, name, -1, importationSourceName, I18n::translate((moduleChildren + i)->text()))) {
+          break;
         }
-      } else {
-        //TODO get module variables that are not in the toolbox
       }
     } else {
-      // Try fetching the nodes from a script
-      Script importedScript;
-      const char * scriptFullName;
-      if (importationSourceIsScript(importationSourceName, &scriptFullName, &importedScript)) {
-        loadGlobalAndImportedVariablesInScriptAsImported(importedScript, textToAutocomplete, textToAutocompleteLength);
-      }
-    }
-  }
-  return true;
-}
-
-const char * VariableBoxController::importationSourceNameFromNode(mp_parse_node_t & node) {
-  if (MP_PARSE_NODE_IS_LEAF(node) && MP_PARSE_NODE_LEAF_KIND(node) == MP_PARSE_NODE_ID) {
-    // The importation source is "simple", for instance: from math import *
-    return qstr_str(MP_PARSE_NODE_LEAF_ARG(node));
-  }
-  if (MP_PARSE_NODE_IS_STRUCT(node)) { //TODO replace this with an assert?
-    mp_parse_node_struct_t * nodePNS = (mp_parse_node_struct_t *)node;
-    uint nodeStructKind = MP_PARSE_NODE_STRUCT_KIND(nodePNS);
-    if (nodeStructKind != PN_dotted_name) {
-      return nullptr;
+      //TODO get module variables that are not in the toolbox
     }
-    /* The importation source is "complex", for instance:
-     * from matplotlib.pyplot import *
-     * FIXME The solution would be to build a single qstr for this name,
-     * such as in python/src/compile.c, function do_import_name, from line
-     * 1117 (found by searching PN_dotted_name).
-     * We might do this later, for now the only dotted name we might want to
-     * find is matplolib.pyplot, so we do a very specific search. */
-    int numberOfSplitNames = MP_PARSE_NODE_STRUCT_NUM_NODES(nodePNS);
-    if (numberOfSplitNames != 2) {
-      return nullptr;
-    }
-    const char * nodeSubName = qstr_str(MP_PARSE_NODE_LEAF_ARG(nodePNS->nodes[0]));
-    if (strcmp(nodeSubName, qstr_str(MP_QSTR_matplotlib)) == 0) {
-      nodeSubName = qstr_str(MP_PARSE_NODE_LEAF_ARG(nodePNS->nodes[1]));
-      if (strcmp(nodeSubName, qstr_str(MP_QSTR_pyplot)) == 0) {
-        return qstr_str(MP_QSTR_matplotlib_dot_pyplot);
-      }
+  } else {
+    // Try fetching the nodes from a script
+    Script importedScript;
+    const char * scriptFullName;
+    if (importationSourceIsScript(importationSourceName, &scriptFullName, &importedScript)) {
+      loadGlobalAndImportedVariablesInScriptAsImported(importedScript, textToAutocomplete, textToAutocompleteLength);
     }
   }
-  return nullptr;
 }
 
 bool VariableBoxController::importationSourceIsModule(const char * sourceName, const ToolboxMessageTree * * moduleChildren, int * numberOfModuleChildren) {
@@ -858,32 +813,6 @@ bool VariableBoxController::importationSourceIsScript(const char * sourceName, c
    return true;
 }
 
-const char * structName(mp_parse_node_struct_t * structNode) {
-  // Find the id child node, which stores the struct's name
-  size_t childNodesCount = MP_PARSE_NODE_STRUCT_NUM_NODES(structNode);
-  if (childNodesCount < 1) {
-    return nullptr;
-  }
-  mp_parse_node_t child = structNode->nodes[0];
-  if (MP_PARSE_NODE_IS_LEAF(child)
-      && MP_PARSE_NODE_LEAF_KIND(child) == MP_PARSE_NODE_ID)
-  {
-    uintptr_t arg = MP_PARSE_NODE_LEAF_ARG(child);
-    return qstr_str(arg);
-  }
-  return nullptr;
-}
-
-bool VariableBoxController::addImportStructFromScript(mp_parse_node_struct_t * pns, uint structKind, const char * scriptName, const char * textToAutocomplete, int textToAutocompleteLength) {
-  assert(structKind == PN_funcdef || structKind == PN_expr_stmt);
-  // Find the id child node, which stores the struct's name
-  const char * name = structName(pns);
-  if (name == nullptr) {
-    return false;
-  }
-  return addNodeIfMatches(textToAutocomplete, textToAutocompleteLength, structKind == PN_funcdef ? ScriptNode::Type::WithParentheses : ScriptNode::Type::WithoutParentheses, k_importedOrigin, name, -1, scriptName);
-}
-
 // The returned boolean means we should escape the process
 bool VariableBoxController::addNodeIfMatches(const char * textToAutocomplete, int textToAutocompleteLength, ScriptNode::Type nodeType, uint8_t nodeOrigin, const char * nodeName, int nodeNameLength, const char * nodeSourceName, const char * nodeDescription) {
   if (m_nodesCount >= k_maxScriptNodesCount) {
@@ -83,12 +83,13 @@ private:
   void loadImportedVariablesInScript(const char * scriptContent, const char * textToAutocomplete, int textToAutocompleteLength);
   void loadCurrentVariablesInScript(const char * scriptContent, const char * textToAutocomplete, int textToAutocompleteLength);
   void loadGlobalAndImportedVariablesInScriptAsImported(Script script, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules = true);
-  // Returns true if this was an import structure
-  bool addNodesFromImportMaybe(mp_parse_node_struct_t * parseNode, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules = true);
-  const char * importationSourceNameFromNode(mp_parse_node_t & node);
+  void loadImportsInStatement(mp_parse_node_t parseNode, const char * text, size_t length, const char * textToAutocomplete, int textToAutocompleteLength);
+  // Add the nodes of the symbols of an index of text
+  void loadSymbols(const ScriptSymbolIndex * index, const char * text, const char * scriptName, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules = true);
+  void loadImportedSymbols(const ScriptSymbolIndex * index, int structureIndex, const char * text, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules);
+  static const char * SymbolName(const char * text, const ScriptSymbolIndex::Symbol * symbol);
   bool importationSourceIsModule(const char * sourceName, const Escher::ToolboxMessageTree * * moduleChildren = nullptr, int * numberOfModuleChildren = nullptr);
   bool importationSourceIsScript(const char * sourceName, const char * * scriptFullName, Script * retreivedScript = nullptr);
-  bool addImportStructFromScript(mp_parse_node_struct_t * pns, uint structKind, const char * scriptName, const char * textToAutocomplete, int textToAutocompleteLength);
   /* Add a node if it completes the text to autocomplete and if it is not
    * already contained in the variable box. The returned boolean means we
    * should escape the node scanning process (due to the lexicographical order
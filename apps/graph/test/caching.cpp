@@ -1,5 +1,7 @@
 #include <quiz.h>
 #include "helper.h"
+#include <poincare/rational.h>
+#include <poincare/symbol.h>
 #include <cmath>
 
 using namespace Poincare;
@@ -121,4 +123,54 @@ QUIZ_CASE(graph_caching) {
   assert_cache_stays_valid(Polar, "cos(5θ)", -1e8f, 1e8f);
 }
 
+void assert_cache_is_kept(ContinuousFunctionStore * store, Ion::Storage::Record record, ContinuousFunctionCache * cache, bool isKept) {
+  quiz_assert(store->modelForRecord(record)->cache() == (isKept ? cache : nullptr));
+}
+
+QUIZ_CASE(graph_caching_dependencies) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  globalContext.setExpressionForSymbolAbstract(Rational::Builder(2), Symbol::Builder('a'));
+  globalContext.setExpressionForSymbolAbstract(Rational::Builder(3), Symbol::Builder('b'));
+  Ion::Storage::Record a = Ion::Storage::sharedStorage()->recordBaseNamedWithExtension("a", Ion::Storage::expExtension);
+  Ion::Storage::Record b = Ion::Storage::sharedStorage()->recordBaseNamedWithExtension("b", Ion::Storage::expExtension);
+
+  constexpr int numberOfFunctions = 3;
+  const char * definitions[numberOfFunctions] = {"a×x", "f(x)+1", "x^2"};
+  Ion::Storage::Record records[numberOfFunctions];
+  ContinuousFunctionCache caches[numberOfFunctions];
+  for (int i = 0; i < numberOfFunctions; i++) {
+    records[i] = *addFunction(definitions[i], Cartesian, &functionStore, &globalContext);
+  }
+  quiz_assert(strcmp(records[0].fullName(), "f.func") == 0);
+
+  for (int i = 0; i < numberOfFunctions; i++) {
+    ExpiringPointer<ContinuousFunction> function = functionStore.modelForRecord(records[i]);
+    function->expressionReduced(&globalContext);
+    function->setCache(caches + i);
+  }
+  // Only the functions which read b are reset
+  functionStore.storageDidChangeForRecord(b);
+  for (int i = 0; i < numberOfFunctions; i++) {
+    assert_cache_is_kept(&functionStore, records[i], caches + i, true);
+  }
+  // g(x) reads a through f(x)
+  globalContext.setExpressionForSymbolAbstract(Rational::Builder(5), Symbol::Builder('a'));
+  functionStore.storageDidChangeForRecord(a);
+  assert_cache_is_kept(&functionStore, records[0], caches, false);
+  assert_cache_is_kept(&functionStore, records[1], caches + 1, false);
+  assert_cache_is_kept(&functionStore, records[2], caches + 2, true);
+  quiz_assert(functionStore.modelForRecord(records[1])->evaluateXYAtParameter(1.f, &globalContext).x2() == 6.f);
+
+  // Any function is reset when the changed record is unknown
+  functionStore.modelForRecord(records[0])->setCache(caches);
+  functionStore.storageDidChangeForRecord(Ion::Storage::Record());
+  assert_cache_is_kept(&functionStore, records[0], caches, false);
+  assert_cache_is_kept(&functionStore, records[2], caches + 2, false);
+
+  functionStore.removeAll();
+  a.destroy();
+  b.destroy();
+}
+
 }
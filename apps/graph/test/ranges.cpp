@@ -48,6 +48,7 @@ void assert_best_range_is(const char * const (&definitions)[N], ContinuousFuncti
       && targetXMin < targetXMax && targetYMin < targetYMax);
 
   Preferences::sharedPreferences()->setAngleUnit(angleUnit);
+  Preferences::sharedPreferences()->setComplexFormat(Preferences::ComplexFormat::Cartesian);
 
   AdHocGraphController graphController;
   InteractiveCurveViewRange graphRange(&graphController);
@@ -64,6 +65,8 @@ void assert_best_range_is(const char * const (&definitions)[N], ContinuousFuncti
   quiz_assert(float_equal(xMin, targetXMin) && float_equal(xMax, targetXMax) && float_equal(yMin, targetYMin) && float_equal(yMax, targetYMax));
 
   graphController.functionStore()->removeAll();
+  Preferences defaultPreferences;
+  Preferences::sharedPreferences()->setComplexFormat(defaultPreferences.complexFormat());
 }
 
 void assert_best_cartesian_range_is(const char * definition, float targetXMin, float targetXMax, float targetYMin, float targetYMax, Poincare::Preferences::AngleUnit angleUnit = Radian, ContinuousFunction::PlotType plotType = Cartesian) {
@@ -339,6 +339,7 @@ void ContinuousFunction::yRangeForDisplay(float xMin, float xMax, float yMinForc
 
 void ContinuousFunction::Model::tidy() const {
   m_expressionDerivate = Expression();
+  m_dependencies.reset();
   ExpressionModel::tidy();
 }
 
@@ -350,8 +351,21 @@ size_t ContinuousFunction::Model::expressionSize(const Ion::Storage::Record * re
   return record->value().size-sizeof(RecordDataBuffer);
 }
 
-Expression ContinuousFunction::Model::expressionDerivateReduced(const Ion::Storage::Record * record, Poincare::Context * context) const {
+Expression ContinuousFunction::Model::expressionReduced(const Ion::Storage::Record * record, Poincare::Context * context) const {
+  if (!m_expression.isUninitialized()) {
+    return m_expression;
+  }
+  m_dependencies.reset();
+  RecordDependencies::RecordingContext recordingContext(context, &m_dependencies);
+  Expression result = ExpressionModel::expressionReduced(record, &recordingContext);
+  updateDependencies(result);
+  return result;
+}
+
+Expression ContinuousFunction::Model::expressionDerivateReduced(const Ion::Storage::Record * record, Poincare::Context * parentContext) const {
   if (m_expressionDerivate.isUninitialized()) {
+    RecordDependencies::RecordingContext recordingContext(parentContext, &m_dependencies);
+    Poincare::Context * context = &recordingContext;
     m_expressionDerivate = Poincare::Derivative::Builder(expressionReduced(record, context).clone(), Symbol::Builder(UCodePointUnknown), Symbol::Builder(UCodePointUnknown));
     /* On complex functions, this step can take a significant time.
      * A workaround could be to identify big functions to skip simplification at
@@ -362,10 +376,24 @@ Expression ContinuousFunction::Model::expressionDerivateReduced(const Ion::Stora
     if (m_expressionDerivate.isUninitialized()) {
       m_expressionDerivate = Poincare::Derivative::Builder(expressionReduced(record, context).clone(), Symbol::Builder(UCodePointUnknown), Symbol::Builder(UCodePointUnknown));
     }
+    updateDependencies(m_expressionDerivate);
   }
   return m_expressionDerivate;
 }
 
+void ContinuousFunction::Model::updateDependencies(const Expression & e) const {
+  /* If the reduction was interrupted or left symbols, the approximation reads
+   * the context again, beyond the names recorded. */
+  bool readsContext = e.hasExpression([](const Expression e, const void * context) {
+      return e.type() == ExpressionNode::Type::Function
+          || e.type() == ExpressionNode::Type::Sequence
+          || (e.type() == ExpressionNode::Type::Symbol && !static_cast<const Symbol &>(e).isSystemSymbol());
+      }, nullptr);
+  if (readsContext) {
+    m_dependencies.setDependsOnAnyRecord();
+  }
+}
+
 ContinuousFunction::RecordDataBuffer * ContinuousFunction::recordData() const {
   assert(!isNull());
   Ion::Storage::Record::Data d = value();
@@ -13,6 +13,7 @@
 #include "continuous_function_cache.h"
 #include "function.h"
 #include "range_1D.h"
+#include "record_dependencies.h"
 #include <poincare/symbol.h>
 #include <poincare/coordinate_2D.h>
 
@@ -33,6 +34,7 @@ public:
   CodePoint symbol() const override;
   Poincare::Expression expressionReduced(Poincare::Context * context) const override;
   Poincare::Expression expressionDerivateReduced(Poincare::Context * context) const { return m_model.expressionDerivateReduced(this, context); }
+  bool dependsOnRecord(Ion::Storage::Record record) const override { return m_model.dependsOnRecord(record); }
 
   static constexpr int k_numberOfPlotTypes = 3;
   enum class PlotType : uint8_t {
@@ -129,12 +131,17 @@ private:
     Model() : ExpressionModel(),
         m_expressionDerivate()
         {}
+    Poincare::Expression expressionReduced(const Ion::Storage::Record * record, Poincare::Context * context) const override;
     Poincare::Expression expressionDerivateReduced(const Ion::Storage::Record * record, Poincare::Context * context) const;
+    bool dependsOnRecord(Ion::Storage::Record record) const { return m_dependencies.contain(record); }
     void tidy() const override;
   private:
     void * expressionAddress(const Ion::Storage::Record * record) const override;
     size_t expressionSize(const Ion::Storage::Record * record) const override;
+    void updateDependencies(const Poincare::Expression & e) const;
     mutable Poincare::Expression m_expressionDerivate;
+    // Names read from the context to reduce the expression and its derivative
+    mutable RecordDependencies m_dependencies;
   };
   size_t metaDataSize() const override { return sizeof(RecordDataBuffer); }
   const ExpressionModel * model() const override { return &m_model; }
@@ -24,6 +24,9 @@ public:
   virtual bool isDefined();
   virtual bool isEmpty();
   virtual bool shouldBeClearedBeforeRemove() { return !isEmpty(); }
+  /* Whether what the handle memoizes might be outdated once the record has
+   * changed. Without more information, it might always be. */
+  virtual bool dependsOnRecord(Ion::Storage::Record record) const { return true; }
   /* tidy is responsible to tidy the whole model whereas tidyExpressionModel
    * tidies only the members associated with the ExpressionModel. In
    * ExpressionModel, tidy and tidyExpressionModel trigger the same
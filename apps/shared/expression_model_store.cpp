@@ -16,11 +16,17 @@ Ion::Storage::Record ExpressionModelStore::recordAtIndex(int i) const {
 }
 
 ExpressionModelHandle * ExpressionModelStore::privateModelForRecord(Ion::Storage::Record record) const {
+  int emptyIndex = -1;
   for (int i = 0; i < maxNumberOfMemoizedModels(); i++) {
-    if (!memoizedModelAtIndex(i)->isNull() && *memoizedModelAtIndex(i) == record) {
+    if (memoizedModelAtIndex(i)->isNull()) {
+      emptyIndex = emptyIndex < 0 ? i : emptyIndex;
+    } else if (*memoizedModelAtIndex(i) == record) {
       return memoizedModelAtIndex(i);
     }
   }
+  if (emptyIndex >= 0) {
+    return setMemoizedModelAtIndex(emptyIndex, record);
+  }
   ExpressionModelHandle * result = setMemoizedModelAtIndex(m_oldestMemoizedIndex, record);
   m_oldestMemoizedIndex = (m_oldestMemoizedIndex+1) % maxNumberOfMemoizedModels();
   return result;
@@ -37,7 +43,24 @@ void ExpressionModelStore::removeModel(Ion::Storage::Record record) {
 }
 
 void ExpressionModelStore::tidy() {
-  resetMemoizedModelsExceptRecord();
+  resetMemoizedModels();
+}
+
+void ExpressionModelStore::storageDidChangeForRecord(const Ion::Storage::Record record) const {
+  if (record.isNull()) {
+    // Any record might have changed
+    resetMemoizedModels();
+    return;
+  }
+  /* The model of the record itself is kept: it is being edited and takes care
+   * of its own memoization. */
+  Ion::Storage::Record emptyRecord;
+  for (int i = 0; i < maxNumberOfMemoizedModels(); i++) {
+    ExpressionModelHandle * model = memoizedModelAtIndex(i);
+    if (*model != record && model->dependsOnRecord(record)) {
+      setMemoizedModelAtIndex(i, emptyRecord);
+    }
+  }
 }
 
 int ExpressionModelStore::numberOfModelsSatisfyingTest(ModelTest test, void * context) const {
@@ -73,12 +96,10 @@ Ion::Storage::Record ExpressionModelStore::recordSatisfyingTestAtIndex(int i, Mo
   return record;
 }
 
-void ExpressionModelStore::resetMemoizedModelsExceptRecord(const Ion::Storage::Record record) const {
+void ExpressionModelStore::resetMemoizedModels() const {
   Ion::Storage::Record emptyRecord;
   for (int i = 0; i < maxNumberOfMemoizedModels(); i++) {
-    if (*memoizedModelAtIndex(i) != record) {
-      setMemoizedModelAtIndex(i, emptyRecord);
-    }
+    setMemoizedModelAtIndex(i, emptyRecord);
   }
 }
 
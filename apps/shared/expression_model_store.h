@@ -37,7 +37,7 @@ public:
 
   // Other
   virtual void tidy();
-  void storageDidChangeForRecord(const Ion::Storage::Record record) const { resetMemoizedModelsExceptRecord(record); }
+  void storageDidChangeForRecord(const Ion::Storage::Record record) const;
 protected:
   int maxNumberOfMemoizedModels() const { return maxNumberOfModels() < 0 ? k_maxNumberOfMemoizedModels : maxNumberOfModels(); }
   typedef bool (*ModelTest)(ExpressionModelHandle * model, void * context);
@@ -48,7 +48,7 @@ protected:
   }
   ExpressionModelHandle * privateModelForRecord(Ion::Storage::Record record) const;
 private:
-  void resetMemoizedModelsExceptRecord(const Ion::Storage::Record record = Ion::Storage::Record()) const;
+  void resetMemoizedModels() const;
   virtual ExpressionModelHandle * setMemoizedModelAtIndex(int cacheIndex, Ion::Storage::Record) const = 0;
   virtual ExpressionModelHandle * memoizedModelAtIndex(int cacheIndex) const = 0;
   virtual const char * modelExtension() const = 0;
@@ -56,7 +56,8 @@ private:
    * present, we override the m_oldestMemoizedIndex model. This actually
    * overrides the oldest memoized model because models are all reset at the
    * same time. Otherwise, we should use a queue to decide which was the last
-   * memoized model. */
+   * memoized model. A change in the storage only resets the models which
+   * depend on the changed record: the reset models are overridden first. */
   mutable int m_oldestMemoizedIndex;
 };
 
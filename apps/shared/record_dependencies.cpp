@@ -0,0 +1,73 @@
+#include "record_dependencies.h"
+#include <poincare/symbol.h>
+#include <ion.h>
+#include <string.h>
+
+using namespace Poincare;
+
+namespace Shared {
+
+Context::SymbolAbstractType RecordDependencies::RecordingContext::expressionTypeForIdentifier(const char * identifier, int length) {
+  m_dependencies->addName(identifier, length);
+  return ContextWithParent::expressionTypeForIdentifier(identifier, length);
+}
+
+const Expression RecordDependencies::RecordingContext::expressionForSymbolAbstract(const SymbolAbstract & symbol, bool clone, float unknownSymbolValue) {
+  if (symbol.type() == ExpressionNode::Type::Sequence) {
+    /* The value of a sequence is computed from the other sequences, out of
+     * this context. */
+    m_dependencies->setDependsOnAnyRecord();
+  } else if (symbol.type() != ExpressionNode::Type::Symbol || !static_cast<const Symbol &>(symbol).isSystemSymbol()) {
+    m_dependencies->addName(symbol.name(), strlen(symbol.name()));
+  }
+  return ContextWithParent::expressionForSymbolAbstract(symbol, clone, unknownSymbolValue);
+}
+
+void RecordDependencies::reset() {
+  m_numberOfNames = 0;
+}
+
+void RecordDependencies::addName(const char * name, int length) {
+  if (m_numberOfNames == k_dependsOnAnyRecord) {
+    return;
+  }
+  uint32_t checksum = NameChecksum(name, length);
+  for (int i = 0; i < m_numberOfNames; i++) {
+    if (m_nameChecksums[i] == checksum) {
+      return;
+    }
+  }
+  if (m_numberOfNames == k_maxNumberOfNames) {
+    setDependsOnAnyRecord();
+    return;
+  }
+  m_nameChecksums[m_numberOfNames++] = checksum;
+}
+
+bool RecordDependencies::contain(Ion::Storage::Record record) const {
+  if (m_numberOfNames == k_dependsOnAnyRecord) {
+    return true;
+  }
+  if (m_numberOfNames == 0) {
+    return false;
+  }
+  const char * fullName = record.fullName();
+  if (fullName == nullptr) {
+    // The record does not exist anymore: its name cannot be compared
+    return true;
+  }
+  const char * dot = strchr(fullName, Ion::Storage::k_dotChar);
+  uint32_t checksum = NameChecksum(fullName, dot == nullptr ? strlen(fullName) : dot - fullName);
+  for (int i = 0; i < m_numberOfNames; i++) {
+    if (m_nameChecksums[i] == checksum) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t RecordDependencies::NameChecksum(const char * name, int length) {
+  return Ion::crc32Byte(reinterpret_cast<const uint8_t *>(name), length);
+}
+
+}
@@ -0,0 +1,48 @@
+#ifndef SHARED_RECORD_DEPENDENCIES_H
+#define SHARED_RECORD_DEPENDENCIES_H
+
+#include <poincare/context_with_parent.h>
+#include <poincare/symbol_abstract.h>
+#include <ion/storage.h>
+#include <stdint.h>
+
+namespace Shared {
+
+/* RecordDependencies lists the names a memoized expression was computed from,
+ * so that the change of a record only invalidates the memoizations which read
+ * it. Names are looked up in the context while reducing the expression: a
+ * RecordingContext placed between the reduction and the context collects them,
+ * whether a record defines them or not. Records are compared by base name, as
+ * a symbol can be defined by records of several extensions. When the names do
+ * not fit, or cannot be known, the expression depends on any record. */
+
+class RecordDependencies {
+public:
+  class RecordingContext : public Poincare::ContextWithParent {
+  public:
+    RecordingContext(Poincare::Context * parentContext, RecordDependencies * dependencies) :
+      ContextWithParent(parentContext),
+      m_dependencies(dependencies)
+    {}
+    SymbolAbstractType expressionTypeForIdentifier(const char * identifier, int length) override;
+    const Poincare::Expression expressionForSymbolAbstract(const Poincare::SymbolAbstract & symbol, bool clone, float unknownSymbolValue = NAN) override;
+  private:
+    RecordDependencies * m_dependencies;
+  };
+
+  RecordDependencies() { reset(); }
+  void reset();
+  void addName(const char * name, int length);
+  void setDependsOnAnyRecord() { m_numberOfNames = k_dependsOnAnyRecord; }
+  bool contain(Ion::Storage::Record record) const;
+private:
+  constexpr static int k_maxNumberOfNames = 8;
+  constexpr static uint8_t k_dependsOnAnyRecord = UINT8_MAX;
+  static uint32_t NameChecksum(const char * name, int length);
+  uint32_t m_nameChecksums[k_maxNumberOfNames];
+  uint8_t m_numberOfNames;
+};
+
+}
+
+#endif
@@ -109,6 +109,12 @@ void EquationStore::approximateSolve(Poincare::Context * context, bool shouldRep
   /* The approximated value for a solution located on one of the bound could be
    * outside the interval, so we need to take a small margin. */
   double boundMargin = maximalStep * Poincare::Solver::k_zeroPrecision;
+  /* The roots of polynomials are all computed at once, instead of being
+   * searched step by step on the interval. */
+  int degree = undevelopedExpression.polynomialDegree(context, m_variables[0]);
+  if (degree > 0 && degree <= Polynomial::k_maxApproximatedDegree && approximatePolynomialSolve(undevelopedExpression, degree, context, boundMargin)) {
+    return;
+  }
   double root;
   for (int i = 0; i <= k_maxNumberOfApproximateSolutions; i++) {
     root = PoincareHelpers::NextRoot(undevelopedExpression, m_variables[0], start, m_intervalApproximateSolutions[1], context, Poincare::Solver::k_relativePrecision, Poincare::Solver::k_minimalStep, maximalStep);
@@ -139,6 +145,29 @@ void EquationStore::approximateSolve(Poincare::Context * context, bool shouldRep
   }
 }
 
+bool EquationStore::approximatePolynomialSolve(const Expression & polynomial, int degree, Poincare::Context * context, double boundMargin) {
+  double roots[Polynomial::k_maxApproximatedDegree];
+  int numberOfRoots = Polynomial::ApproximateRealRoots(polynomial, m_variables[0], degree, roots, context, Preferences::sharedPreferences()->angleUnit());
+  if (numberOfRoots < 0) {
+    return false;
+  }
+  for (int i = 0; i < numberOfRoots; i++) {
+    if (roots[i] < m_intervalApproximateSolutions[0] - boundMargin || roots[i] > m_intervalApproximateSolutions[1] + boundMargin) {
+      continue;
+    }
+    // The equation might not be defined at the root of its polynomial
+    if (std::isnan(PoincareHelpers::ApproximateWithValueForSymbol(polynomial, m_variables[0], roots[i], context))) {
+      continue;
+    }
+    if (m_numberOfSolutions == k_maxNumberOfApproximateSolutions) {
+      m_hasMoreThanMaxNumberOfApproximateSolution = true;
+      break;
+    }
+    m_approximateSolutions[m_numberOfSolutions++] = roots[i];
+  }
+  return true;
+}
+
 EquationStore::Error EquationStore::exactSolve(Poincare::Context * context, bool * replaceFunctionsButNotSymbols) {
   assert(replaceFunctionsButNotSymbols != nullptr);
   // First, solve the equation using predefined variables if there are
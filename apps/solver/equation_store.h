@@ -96,6 +96,7 @@ private:
   Error privateExactSolve(Poincare::Context * context, bool replaceFunctionsButNotSymbols);
   Error resolveLinearSystem(Poincare::Expression solutions[k_maxNumberOfExactSolutions], Poincare::Expression solutionApproximations[k_maxNumberOfExactSolutions], Poincare::Expression coefficients[k_maxNumberOfEquations][Poincare::Expression::k_maxNumberOfVariables], Poincare::Expression constants[k_maxNumberOfEquations], Poincare::Context * context);
   Error oneDimensialPolynomialSolve(Poincare::Expression solutions[k_maxNumberOfExactSolutions], Poincare::Expression solutionApproximations[k_maxNumberOfExactSolutions], Poincare::Expression polynomialCoefficients[Poincare::Expression::k_maxNumberOfPolynomialCoefficients], Poincare::Context * context);
+  bool approximatePolynomialSolve(const Poincare::Expression & polynomial, int degree, Poincare::Context * context, double boundMargin);
   void tidySolution();
   bool isExplictlyComplex(Poincare::Context * context);
   Poincare::Preferences::ComplexFormat updatedComplexFormat(Poincare::Context * context);
@@ -2,6 +2,7 @@
 #include "helpers.h"
 
 QUIZ_CASE(equation_solve) {
+  set_complex_format(Cartesian);
   assert_solves_to_error("x+y+z+a+b+c+d=0", TooManyVariables);
   assert_solves_to_error("x^2+y=0", NonLinearSystem);
   assert_solves_to_error("cos(x)=0", RequireApproximateSolution);
@@ -110,6 +111,13 @@ QUIZ_CASE(equation_solve) {
   assert_solves_numerically_to("-2/(x-4)=-x^2+2x-4", -10, 10, {4.154435});
   assert_solves_numerically_to("0^x=0", -10, 10, {0.2, 0.4, 0.6, 0.8, 1.0, 1.2, 1.4, 1.6, 1.8, 2.0});
 
+  // Monovariable polynomial equations of high degree
+  assert_solves_numerically_to("x^5-x-1=0", -10, 10, {1.167304});
+  assert_solves_numerically_to("(x-1)(x-2)(x-3)(x-4)(x-5)(x-6)=0", 1.5, 10, {2, 3, 4, 5, 6});
+  assert_solves_numerically_to("x^12=1", -10, 10, {-1, 1});
+  assert_solves_numerically_to("(x-1)^3×(x+2)^2=x^5-x^5", -10, 10, {-2, 1});
+  assert_solves_numerically_to("x^11-x=0", -10, 10, {-1, 0, 1});
+
   // The ends of the interval are solutions
   assert_solves_numerically_to("sin(x)=0", -180, 180, {-180, 0, 180});
   assert_solves_numerically_to("(x-1)^2×(x+1)^2=0", -1, 1, {-1, 1});
@@ -126,6 +134,7 @@ QUIZ_CASE(equation_solve) {
 
   assert_solves_to_error("(x-10)^7=0", RequireApproximateSolution);
   assert_solves_numerically_to("(x-10)^7=0", -100, 100, {10});
+  reset_complex_format();
 }
 
 
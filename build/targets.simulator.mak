@@ -1 +1,13 @@
+# Headless runner of the Python benchmark corpus, see python/benchmark/compare.py
+python_benchmark_runner_src = $(base_src) $(apps_tests_src) $(filter-out %/tests_symbols.c,$(runner_src)) $(BUILD_DIR)/quiz/src/python_benchmark_symbols.c apps/exam_mode_configuration.cpp $(python_benchmark_src)
+$(call object_for,$(BUILD_DIR)/quiz/src/python_benchmark_symbols.c): SFLAGS += -Iquiz/src
+$(BUILD_DIR)/python_benchmark.$(EXE): $(call flavored_object_for,$(python_benchmark_runner_src),consoledisplay)
+HANDY_TARGETS += python_benchmark
+
+# Headless runner of the native benchmarks, which print their measures
+benchmark_runner_src = $(base_src) $(apps_tests_src) $(filter-out %/tests_symbols.c,$(runner_src)) $(BUILD_DIR)/quiz/src/benchmark_symbols.c apps/exam_mode_configuration.cpp $(benchmark_src)
+$(call object_for,$(BUILD_DIR)/quiz/src/benchmark_symbols.c): SFLAGS += -Iquiz/src
+$(BUILD_DIR)/benchmark.$(EXE): $(call flavored_object_for,$(benchmark_runner_src),consoledisplay)
+HANDY_TARGETS += benchmark
+
 -include build/targets.simulator.$(TARGET).mak
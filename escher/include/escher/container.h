@@ -14,6 +14,7 @@
 #include <escher/app.h>
 #include <escher/window.h>
 #include <ion/events.h>
+#include <stddef.h>
 
 namespace Escher {
 
@@ -30,6 +31,7 @@ public:
   Container& operator=(const Container& other) = delete;
   Container& operator=(Container&& other) = delete;
   virtual void * currentAppBuffer() = 0;
+  virtual size_t currentAppBufferSize() = 0;
   virtual void run();
   virtual bool dispatchEvent(Ion::Events::Event event) override;
   virtual void switchToBuiltinApp(App::Snapshot * snapshot);
@@ -48,6 +48,10 @@ uint32_t crc32Byte(const uint8_t * data, size_t length);
 // Provides a true random number
 uint32_t random();
 
+/* Make instructions written to RAM visible to the instruction fetch, e.g.
+ * code generated by a JIT compiler */
+void synchronizeInstructionCache();
+
 // Decompress data
 void decompress(const uint8_t * src, uint8_t * dst, int srcSize, int dstSize);
 
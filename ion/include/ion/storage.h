@@ -188,7 +188,10 @@ private:
  * We could have computed and compared the checksum of the storage to detect
  * storage invalidity, but profiling showed that this slows down the execution
  * (for example when scrolling the functions list).
- * We thus decided to notify a delegate when the storage changes. */
+ * We thus decided to notify a delegate when the storage changes. The delegate
+ * is given the changed record, so that memoizations which did not read it can
+ * be kept, or a null record when any record might have changed (when records
+ * are destroyed or renamed). */
 
 class StorageDelegate {
 public:
@@ -12,6 +12,7 @@
 #include <kernel/drivers/timing.h>
 #include <shared/drivers/backlight.h>
 #include <shared/drivers/battery.h>
+#include <shared/drivers/cache.h>
 #include <shared/drivers/crc32.h>
 #include <shared/drivers/display.h>
 #include <shared/drivers/flash_privileged.h>
@@ -81,7 +82,8 @@ void * const k_SVCallTable[SVC_NUMBER_OF_CALLS] = {
   MAKE_SVCALL_HANDLER_ENTRY(Ion::Device::USB::didExecuteDFU),
   MAKE_SVCALL_HANDLER_ENTRY(Ion::USB::isPlugged),
   MAKE_SVCALL_HANDLER_ENTRY(Ion::Device::USB::shouldInterruptDFU),
-  MAKE_SVCALL_HANDLER_ENTRY(Ion::Device::USB::willExecuteDFU)
+  MAKE_SVCALL_HANDLER_ENTRY(Ion::Device::USB::willExecuteDFU),
+  MAKE_SVCALL_HANDLER_ENTRY(Ion::Device::Cache::synchronizeInstructionCache)
 };
 
 template <class T1, class T2> struct SameType { enum{value = false}; };
@@ -180,6 +182,7 @@ void * svcallHandler(int svcNumber) {
   ENSURE_SVC_TYPE(SVC_USB_IS_PLUGGED, Ion::USB::isPlugged)
   ENSURE_SVC_TYPE(SVC_USB_SHOULD_INTERRUPT, Ion::Device::USB::shouldInterruptDFU)
   ENSURE_SVC_TYPE(SVC_USB_WILL_EXECUTE_DFU, Ion::Device::USB::willExecuteDFU)
+  ENSURE_SVC_TYPE(SVC_CACHE_SYNCHRONIZE_INSTRUCTION_CACHE, Ion::Device::Cache::synchronizeInstructionCache)
   return k_SVCallTable[svcNumber];
 }
 
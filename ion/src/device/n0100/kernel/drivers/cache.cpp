@@ -18,6 +18,8 @@ void invalidateICache() {}
 void enableICache() {}
 void disableICache() {}
 
+void synchronizeInstructionCache() {}
+
 }
 }
 }
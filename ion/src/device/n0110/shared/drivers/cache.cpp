@@ -90,6 +90,11 @@ void enableICache() {
   isb();
 }
 
+void synchronizeInstructionCache() {
+  cleanDCache();
+  invalidateICache();
+}
+
 void disableICache() {
   dsb();
   isb();
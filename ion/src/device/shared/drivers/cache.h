@@ -37,6 +37,10 @@ void invalidateICache();
 void enableICache();
 void disableICache();
 
+/* Write back the data cache and invalidate the instruction cache, so that
+ * instructions written to RAM can be executed */
+void synchronizeInstructionCache();
+
 }
 }
 }
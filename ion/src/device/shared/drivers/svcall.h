@@ -91,8 +91,11 @@ namespace SVCall {
 #define SVC_USB_IS_PLUGGED 52
 #define SVC_USB_SHOULD_INTERRUPT 53
 #define SVC_USB_WILL_EXECUTE_DFU 54
+/* Calls added after the alphabetical list above are appended, so that a
+ * userland calling them on an older kernel is safely ignored. */
+#define SVC_CACHE_SYNCHRONIZE_INSTRUCTION_CACHE 55
 
-#define SVC_NUMBER_OF_CALLS 55
+#define SVC_NUMBER_OF_CALLS 56
 
 }
 }
@@ -0,0 +1,10 @@
+#include <ion.h>
+#include <userland/drivers/svcall.h>
+
+namespace Ion {
+
+void SVC_ATTRIBUTES synchronizeInstructionCache() {
+  SVC_RETURNING_VOID(SVC_CACHE_SYNCHRONIZE_INSTRUCTION_CACHE)
+}
+
+}
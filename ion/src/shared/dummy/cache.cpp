@@ -0,0 +1,6 @@
+#include <ion.h>
+
+/* Generated code only runs on hosts which keep their instruction cache
+ * coherent with data writes. */
+void Ion::synchronizeInstructionCache() {
+}
@@ -1,6 +1,7 @@
 #include <ion/events.h>
 #include <ion/timing.h>
 #include <ion/display.h>
+#include <ion/storage.h>
 #include "../../../poincare/include/poincare/print_int.h"
 #include <assert.h>
 
@@ -9,22 +10,31 @@ namespace Events {
 
 class Scenario {
 public:
+  typedef void (*SetUp)();
   template <int N>
-  constexpr static Scenario build(const char * name, const Event (&events)[N]) {
-    return Scenario(name, events, N);
+  constexpr static Scenario build(const char * name, const Event (&events)[N], SetUp setUp = nullptr) {
+    return Scenario(name, events, N, setUp);
   }
   const char * name() const { return m_name; }
+  // Prepare the state the events expect, before the first one
+  void setUp() const {
+    if (m_setUp != nullptr) {
+      m_setUp();
+    }
+  }
   const int numberOfEvents() const { return m_numberOfEvents; }
   const Event eventAtIndex(int index) const { return m_events[index]; }
 
   private:
-  constexpr Scenario(const char * name, const Event * events, int numberOfEvents) :
+  constexpr Scenario(const char * name, const Event * events, int numberOfEvents, SetUp setUp) :
     m_name(name),
     m_events(events),
-    m_numberOfEvents(numberOfEvents) {}
+    m_numberOfEvents(numberOfEvents),
+    m_setUp(setUp) {}
   const char * m_name;
   const Event * m_events;
   int m_numberOfEvents;
+  SetUp m_setUp;
 };
 
 static constexpr Event scenarioCalculation[] = {
@@ -37,6 +47,63 @@ static constexpr Event scenarioFunctionCosSin[] = { Right, OK, OK, Cosine, XNT,
 static constexpr Event scenarioPythonMandelbrot[] = { Right, Right, OK, Down, Down, Down, Down, OK, Var, Down, OK, One, Five, OK, Home, Home
 };
 
+/* The native and viper variants of the Mandelbrot script. The keyboard cannot
+ * type '@' and the default scripts do not ship them, so the benchmark stores
+ * them in a script of its own. They only compile on platforms where
+ * MicroPython can emit machine code. */
+static constexpr char k_nativeMandelbrotScriptName[] = "mandelbrot_native.py";
+static constexpr char k_nativeMandelbrotScript[] = R"(import kandinsky
+@micropython.native
+def mandelbrot_native(N_iteration):
+  for x in range(320):
+    for y in range(222):
+      z = complex(0,0)
+      c = complex(3.5*x/319-2.5, -2.5*y/221+1.25)
+      i = 0
+      while (i < N_iteration) and abs(z) < 2:
+        i = i + 1
+        z = z*z+c
+      rgb = int(255*i/N_iteration)
+      col = kandinsky.color(int(rgb),int(rgb*0.75),int(rgb*0.25))
+      kandinsky.set_pixel(x,y,col)
+# Viper code runs on machine integers: z and c are
+# stored in fixed point, with 12 fractional bits
+@micropython.viper
+def mandelbrot_viper(N_iteration: int):
+  for x in range(320):
+    for y in range(222):
+      c_r = 14336*x//319-10240
+      c_i = 5120-10240*y//221
+      z_r = 0
+      z_i = 0
+      i = 0
+      while (i < N_iteration) and z_r*z_r+z_i*z_i < 67108864:
+        i = i + 1
+        t = ((z_r*z_r-z_i*z_i)>>12)+c_r
+        z_i = ((2*z_r*z_i)>>12)+c_i
+        z_r = t
+      rgb = 255*i//N_iteration
+      col = kandinsky.color(rgb,rgb*3//4,rgb//4)
+      kandinsky.set_pixel(x,y,col))";
+
+static void createNativeMandelbrotScript() {
+  if (!Storage::sharedStorage()->recordNamed(k_nativeMandelbrotScriptName).isNull()) {
+    return;
+  }
+  // Scripts start with a status byte: 1 imports them in the console
+  const uint8_t status = 1;
+  const void * dataChunks[] = {&status, k_nativeMandelbrotScript};
+  size_t sizeChunks[] = {sizeof(status), sizeof(k_nativeMandelbrotScript)};
+  Storage::sharedStorage()->createRecordWithFullName(k_nativeMandelbrotScriptName, dataChunks, sizeChunks, 2);
+}
+
+// The script is listed after the default ones: the console is one row further
+static constexpr Event scenarioPythonMandelbrotNative[] = { Right, Right, OK, Down, Down, Down, Down, Down, OK, LowerM, LowerA, LowerN, LowerD, LowerE, LowerL, LowerB, LowerR, LowerO, LowerT, Underscore, LowerN, LowerA, LowerT, LowerI, LowerV, LowerE, LeftParenthesis, One, Five, RightParenthesis, OK, Home, Home
+};
+
+static constexpr Event scenarioPythonMandelbrotViper[] = { Right, Right, OK, Down, Down, Down, Down, Down, OK, LowerM, LowerA, LowerN, LowerD, LowerE, LowerL, LowerB, LowerR, LowerO, LowerT, Underscore, LowerV, LowerI, LowerP, LowerE, LowerR, LeftParenthesis, One, Five, RightParenthesis, OK, Home, Home
+};
+
 static constexpr Event scenarioStatistics[] = { Down, OK, One, OK, Two, OK, Right, Five, OK, One, Zero, OK, Back, Right, OK, Right, Right, Right, OK, One, OK, Down, OK, Back, Right, OK, Back, Right, OK, Down, Down, Down, Down, Down, Down, Down, Down, Down, Down, Up, Up, Up, Up, Up, Up, Up, Up, Up, Home, Home
 };
 
@@ -50,6 +117,8 @@ static constexpr Scenario scenarios[] = {
   Scenario::build("Calc scrolling", scenarioCalculation),
   Scenario::build("Sin/Cos graph", scenarioFunctionCosSin),
   Scenario::build("Mandelbrot(15)", scenarioPythonMandelbrot),
+  Scenario::build("Native (15)", scenarioPythonMandelbrotNative, createNativeMandelbrotScript),
+  Scenario::build("Viper (15)", scenarioPythonMandelbrotViper, createNativeMandelbrotScript),
   Scenario::build("Statistics", scenarioStatistics),
   Scenario::build("Probability", scenarioProbability),
   Scenario::build("Equation", scenarioEquation)
@@ -88,6 +157,9 @@ Event getEvent(int * timeout) {
     while (1) {
     }
   }
+  if (eventIndex == 0) {
+    scenarios[scenarioIndex].setUp();
+  }
   return scenarios[scenarioIndex].eventAtIndex(eventIndex++);
 }
 
@@ -337,7 +337,8 @@ Storage::Record::ErrorStatus Storage::setFullNameOfRecord(const Record record, c
     }
     overrideSizeAtPosition(p, newRecordSize);
     overrideFullNameAtPosition(p+sizeof(record_size_t), fullName);
-    notifyChangeToDelegate(record);
+    // Memoizations depending on the previous name are outdated as well
+    notifyChangeToDelegate();
     m_lastRecordRetrieved = record;
     m_lastRecordRetrievedPointer = p;
     return Record::ErrorStatus::None;
@@ -361,9 +362,10 @@ Storage::Record::ErrorStatus Storage::setBaseNameWithExtensionOfRecord(Record re
     overrideSizeAtPosition(p, newRecordSize);
     char * fullNamePosition = p + sizeof(record_size_t);
     overrideBaseNameWithExtensionAtPosition(fullNamePosition, baseName, extension);
-    // Recompute the CRC32
+    /* Recompute the CRC32. Memoizations depending on the previous name are
+     * outdated as well: the delegate is not told which record changed. */
     record = Record(fullNamePosition);
-    notifyChangeToDelegate(record);
+    notifyChangeToDelegate();
     m_lastRecordRetrieved = record;
     m_lastRecordRetrievedPointer = p;
     return Record::ErrorStatus::None;
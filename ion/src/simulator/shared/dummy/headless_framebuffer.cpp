@@ -0,0 +1,13 @@
+#include "../framebuffer.h"
+
+namespace Ion {
+namespace Simulator {
+namespace Framebuffer {
+
+bool activeWhenHeadless() {
+  return false;
+}
+
+}
+}
+}
@@ -9,6 +9,9 @@ namespace Framebuffer {
 
 const KDColor * address();
 void setActive(bool enabled);
+/* Headless runs do not keep the pixels they draw, unless they read them back:
+ * only the test runners, which are built with the consoledisplay flavor, do. */
+bool activeWhenHeadless();
 
 }
 }
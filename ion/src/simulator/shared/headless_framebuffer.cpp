@@ -0,0 +1,15 @@
+#include "framebuffer.h"
+
+namespace Ion {
+namespace Simulator {
+namespace Framebuffer {
+
+/* The test runners check what they draw by reading the pixels back, as on the
+ * device. */
+bool activeWhenHeadless() {
+  return true;
+}
+
+}
+}
+}
@@ -1,3 +1,4 @@
+#include "framebuffer.h"
 #include "haptics.h"
 #include "journal.h"
 #include "platform.h"
@@ -138,6 +139,9 @@ int main(int argc, char * argv[]) {
 #endif
     Window::init();
     Haptics::init();
+  } else if (Framebuffer::activeWhenHeadless()) {
+    // Keep the pixels pushed to the display, so that they can be read back
+    Framebuffer::setActive(true);
   }
   ion_main(args.argc(), args.argv());
   if (!headless) {
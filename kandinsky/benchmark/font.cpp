@@ -0,0 +1,44 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <kandinsky/font.h>
+
+// Defined in kandinsky/fonts/code_points.h
+extern "C" uint32_t CodePoints[];
+extern "C" int NumberOfCodePoints;
+
+QUIZ_CASE(kandinsky_font_benchmark) {
+  constexpr int textLength = 4096;
+  static char text[textLength+1];
+  const char pattern[] = "f(x)=3·x²+√(2)·π→y ";
+  constexpr int patternLength = sizeof(pattern) - 1;
+  for (int i = 0; i < textLength; i++) {
+    text[i] = pattern[i % patternLength];
+  }
+  text[textLength] = 0;
+
+  constexpr int numberOfRuns = 200;
+  quiz_print("stringSizeUntil, 4096 bytes x 200");
+  uint64_t startTime = quiz_stopwatch_start();
+  int totalWidth = 0;
+  for (int i = 0; i < numberOfRuns; i++) {
+    totalWidth += KDFont::LargeFont->stringSizeUntil(text, text + textLength).width();
+  }
+  quiz_stopwatch_print_lap(startTime);
+  quiz_assert(totalWidth > 0);
+
+  constexpr int numberOfLookups = 1000000;
+  quiz_print("indexForCodePoint, 1000000 lookups");
+  startTime = quiz_stopwatch_start();
+  int glyphIndexSum = 0;
+  for (int i = 0; i < numberOfLookups; i++) {
+    glyphIndexSum += KDFont::LargeFont->indexForCodePoint(CodePoints[i % NumberOfCodePoints]);
+  }
+  quiz_stopwatch_print_lap(startTime);
+  quiz_print("indexForCodePointInTable, 1000000 lookups");
+  startTime = quiz_stopwatch_start();
+  for (int i = 0; i < numberOfLookups; i++) {
+    glyphIndexSum -= KDFont::LargeFont->indexForCodePointInTable(CodePoints[i % NumberOfCodePoints]);
+  }
+  quiz_stopwatch_print_lap(startTime);
+  quiz_assert(glyphIndexSum == 0);
+}
@@ -0,0 +1,70 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <kandinsky/pixel_run.h>
+#include <ion/timing.h>
+#include <poincare/print_int.h>
+#include <string.h>
+
+static KDColor pseudoRandomColor(size_t i) {
+  return KDColor::RGB16(static_cast<uint16_t>(i * 40503u + 0x1234));
+}
+
+static void printThroughput(const char * name, uint64_t numberOfPixels, uint64_t duration) {
+  constexpr int bufferLength = 64;
+  char buffer[bufferLength];
+  int length = strlcpy(buffer, name, bufferLength);
+  if (duration == 0) {
+    duration = 1;
+  }
+  // pixels per ms / 1000 = megapixels per s
+  length += Poincare::PrintInt::Left(numberOfPixels / duration / 1000, buffer + length, bufferLength - length - 1);
+  strlcpy(buffer + length, " Mpx/s", bufferLength - length);
+  quiz_print(buffer);
+}
+
+template <typename Primitive>
+static void benchmark(const char * name, Primitive primitive) {
+  constexpr uint64_t minimalDuration = 50; // ms
+  constexpr int numberOfRunsPerLap = 64;
+  uint64_t numberOfPixels = 0;
+  uint64_t startTime = quiz_stopwatch_start();
+  uint64_t duration;
+  do {
+    for (int i = 0; i < numberOfRunsPerLap; i++) {
+      numberOfPixels += primitive();
+    }
+    duration = Ion::Timing::millis() - startTime;
+  } while (duration < minimalDuration);
+  printThroughput(name, numberOfPixels, duration);
+}
+
+QUIZ_CASE(kandinsky_pixel_run_benchmark) {
+  // A full screen
+  constexpr size_t numberOfPixels = 320*240;
+  static KDColor pixels[numberOfPixels];
+  static KDColor source[numberOfPixels];
+  static uint8_t mask[numberOfPixels];
+  for (size_t i = 0; i < numberOfPixels; i++) {
+    source[i] = pseudoRandomColor(i);
+    mask[i] = i * 7;
+  }
+  quiz_print(KDPixelRun::ImplementationName());
+  benchmark("  fill: ", [&]() {
+    KDPixelRun::Fill(pixels, KDColorRed, numberOfPixels);
+    return numberOfPixels;
+  });
+  benchmark("  copy: ", [&]() {
+    KDPixelRun::Copy(pixels, source, numberOfPixels);
+    return numberOfPixels;
+  });
+  benchmark("  blend with mask: ", [&]() {
+    KDPixelRun::BlendWithMask(pixels, KDColorBlue, mask, numberOfPixels);
+    return numberOfPixels;
+  });
+  benchmark("  scalar blend reference: ", [&]() {
+    for (size_t i = 0; i < numberOfPixels; i++) {
+      pixels[i] = KDColor::blend(pixels[i], KDColorBlue, mask[i]);
+    }
+    return numberOfPixels;
+  });
+}
@@ -199,6 +199,54 @@ int main(int argc, char * argv[]) {
 
   fprintf(sourceFile, "static constexpr size_t tableLength = %d;\n\n", numberOfPairs);
 
+  /* Step 1b - Build the two-level lookup table of the Basic Multilingual Plane
+   * The page table maps the high byte of a code point to a glyph page, which
+   * maps the low byte to a glyph index. Page 0 is shared by every page without
+   * any glyph: it only contains the replacement character's index. */
+
+  int replacementCharacterIndex = -1;
+  for (int i=0; i<NumberOfCodePoints; i++) {
+    if (CodePoints[i] == 0xFFFD) {
+      replacementCharacterIndex = i;
+    }
+  }
+  ENSURE(replacementCharacterIndex >= 0, "The replacement character 0xFFFD must be rasterized");
+  ENSURE(NumberOfCodePoints <= 256, "Glyph indexes must fit in a byte");
+
+  int glyphPageSize = 256;
+  int numberOfPageTableEntries = 0x10000/glyphPageSize;
+  uint8_t pageTable[numberOfPageTableEntries];
+  memset(pageTable, 0, sizeof(pageTable));
+  int numberOfGlyphPages = 1;
+  for (int i=0; i<NumberOfCodePoints; i++) {
+    uint32_t codePoint = CodePoints[i];
+    if (codePoint < 0x10000 && pageTable[codePoint/glyphPageSize] == 0) {
+      pageTable[codePoint/glyphPageSize] = numberOfGlyphPages++;
+    }
+  }
+  ENSURE(numberOfGlyphPages <= 256, "Glyph page indexes must fit in a byte");
+  uint8_t * glyphPages = (uint8_t *)malloc(numberOfGlyphPages*glyphPageSize);
+  memset(glyphPages, replacementCharacterIndex, numberOfGlyphPages*glyphPageSize);
+  for (int i=0; i<NumberOfCodePoints; i++) {
+    uint32_t codePoint = CodePoints[i];
+    if (codePoint < 0x10000) {
+      glyphPages[pageTable[codePoint/glyphPageSize]*glyphPageSize + codePoint%glyphPageSize] = i;
+    }
+  }
+
+  fprintf(sourceFile, "static constexpr uint8_t glyphPageTable[%d] = {", numberOfPageTableEntries);
+  prettyPrintArray(sourceFile, 80, 1, pageTable, numberOfPageTableEntries);
+  fprintf(sourceFile, "};\n\n");
+
+  fprintf(sourceFile, "static constexpr KDFont::GlyphIndex glyphPages[%d][%d] = {\n", numberOfGlyphPages, glyphPageSize);
+  for (int page=0; page<numberOfGlyphPages; page++) {
+    fprintf(sourceFile, "  {");
+    prettyPrintArray(sourceFile, 80, 1, glyphPages + page*glyphPageSize, glyphPageSize);
+    fprintf(sourceFile, "  },\n");
+  }
+  fprintf(sourceFile, "};\n\n");
+  free(glyphPages);
+
   // Step 2 - Build Glyph data
 
   fprintf(sourceFile, "static constexpr KDCoordinate glyphWidth = %d;\n\n", glyph_width);
@@ -271,7 +319,7 @@ int main(int argc, char * argv[]) {
   free(glyphData);
   free(uncompressedGlyphBuffer);
 
-  fprintf(sourceFile, "const KDFont KDFont::private%s(tableLength, table, glyphWidth, glyphHeight, glyphDataOffset, glyphData);\n", font_name);
+  fprintf(sourceFile, "const KDFont KDFont::private%s(tableLength, table, glyphPageTable, glyphPages, glyphWidth, glyphHeight, glyphDataOffset, glyphData);\n", font_name);
 
   fclose(sourceFile);
 
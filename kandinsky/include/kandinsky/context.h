@@ -45,6 +45,9 @@ private:
                                        float horizontalAlignment, const KDFont * font,
                                        KDColor textColor, KDColor backgroundColor, int maxLength);
   KDRect absoluteFillRect(KDRect rect);
+  void renderSingleLineString(const char * text, size_t textLength, const KDFont * font,
+                              KDColor textColor, KDColor backgroundColor,
+                              KDColor * pixels, KDCoordinate runWidth);
   KDPoint pushOrPullString(const char * text, KDPoint p, const KDFont * font, KDColor textColor,
                            KDColor backgroundColor, int maxByteLength, bool push,
                            int * result = nullptr);
@@ -21,7 +21,13 @@
  * kandinsky/fonts/code_points.h). To easily compute the index of a code point in
  * the CodePoints table, we use the m_table matching table: it contains the
  * CodePointIndexPairs of the first code point of each series of consecutive
- * code points in the CodePoints table. This table is create in rasterizer.c. */
+ * code points in the CodePoints table. This table is create in rasterizer.c.
+ *
+ * Since indexForCodePoint is called for every glyph drawn, the rasterizer also
+ * creates a two-level lookup table covering the Basic Multilingual Plane: the
+ * page table maps the high byte of a code point to a glyph page, which maps its
+ * low byte to the glyph index. Code points out of the BMP are looked up in
+ * m_table. */
 
 class KDFont {
 private:
@@ -62,7 +68,19 @@ public:
     GlyphIndex m_glyphIndex;
   };
   static constexpr GlyphIndex IndexForReplacementCharacterCodePoint = 133;
-  GlyphIndex indexForCodePoint(CodePoint c) const;
+  static constexpr int k_glyphPageSize = 256;
+  using GlyphPage = GlyphIndex[k_glyphPageSize];
+  GlyphIndex indexForCodePoint(CodePoint c) const {
+    // ASCII fast path, see signedCharAsIndex
+    if (c >= k_firstASCIICodePoint && c <= k_lastASCIICodePoint) {
+      return c - k_firstASCIICodePoint;
+    }
+    if (m_glyphPageTable != nullptr && c < k_glyphPageSize*k_glyphPageSize) {
+      return m_glyphPages[m_glyphPageTable[c/k_glyphPageSize]][c%k_glyphPageSize];
+    }
+    return indexForCodePointInTable(c);
+  }
+  GlyphIndex indexForCodePointInTable(CodePoint c) const;
 
   void setGlyphGrayscalesForCodePoint(CodePoint codePoint, GlyphBuffer * glyphBuffer) const;
   void setGlyphGrayscalesForCharacter(char c, GlyphBuffer * glyphBuffer) const;
@@ -76,9 +94,13 @@ public:
   }
   KDSize glyphSize() const { return m_glyphSize; }
 
-  constexpr KDFont(size_t tableLength, const CodePointIndexPair * table, KDCoordinate glyphWidth, KDCoordinate glyphHeight, const uint16_t * glyphDataOffset, const uint8_t * data) :
-    m_tableLength(tableLength), m_table(table), m_glyphSize(glyphWidth, glyphHeight), m_glyphDataOffset(glyphDataOffset), m_data(data) { }
+  constexpr KDFont(size_t tableLength, const CodePointIndexPair * table, const uint8_t * glyphPageTable, const GlyphPage * glyphPages, KDCoordinate glyphWidth, KDCoordinate glyphHeight, const uint16_t * glyphDataOffset, const uint8_t * data) :
+    m_tableLength(tableLength), m_table(table), m_glyphPageTable(glyphPageTable), m_glyphPages(glyphPages), m_glyphSize(glyphWidth, glyphHeight), m_glyphDataOffset(glyphDataOffset), m_data(data) { }
 private:
+  static constexpr uint8_t k_magicCharOffsetValue = 0x20; // FIXME: Value from kandinsky/fonts/rasterizer.c (CHARACTER_RANGE_START). 0x20 because we do not want have a glyph for the first 20 ASCII characters
+  static constexpr uint32_t k_firstASCIICodePoint = k_magicCharOffsetValue;
+  static constexpr uint32_t k_lastASCIICodePoint = 0x7E;
+
   void fetchGrayscaleGlyphAtIndex(GlyphIndex index, uint8_t * grayscaleBuffer) const;
 
   const uint8_t * compressedGlyphData(GlyphIndex index) const {
@@ -89,7 +111,6 @@ private:
     return m_glyphDataOffset[index+1] - m_glyphDataOffset[index];
   }
   int signedCharAsIndex(const char c) const {
-    static constexpr uint8_t k_magicCharOffsetValue = 0x20; // FIXME: Value from kandinsky/fonts/rasterizer.c (CHARACTER_RANGE_START). 0x20 because we do not want have a glyph for the first 20 ASCII characters
     int cInt = c;
     if (cInt < 0) {
       /* A char casted as int takes its value between -127 and +128, but we want
@@ -101,6 +122,8 @@ private:
 
   size_t m_tableLength;
   const CodePointIndexPair * m_table;
+  const uint8_t * m_glyphPageTable;
+  const GlyphPage * m_glyphPages;
   KDSize m_glyphSize;
   const uint16_t * m_glyphDataOffset;
   const uint8_t * m_data;
@@ -0,0 +1,28 @@
+#ifndef KANDINSKY_PIXEL_RUN_H
+#define KANDINSKY_PIXEL_RUN_H
+
+#include <kandinsky/color.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* KDPixelRun gathers the primitives operating on a contiguous run of pixels
+ * (a framebuffer row, a glyph buffer...). They are the innermost loops of
+ * every fill, blit and anti-aliased stamp, so they are vectorized whenever the
+ * target allows it. The implementation is selected at compile time:
+ *  - SSE2 on x86 simulators,
+ *  - NEON on ARM simulators (Apple silicon, Android, iOS),
+ *  - DSP SIMD instructions (SMUAD) and word-wide accesses on Cortex-M,
+ *  - a plain scalar loop otherwise.
+ * All implementations produce exactly the same pixels as KDColor::blend. */
+
+class KDPixelRun {
+public:
+  static void Fill(KDColor * pixels, KDColor color, size_t length);
+  // Overlapping runs are supported as long as destination <= source
+  static void Copy(KDColor * destination, const KDColor * source, size_t length);
+  /* pixels[i] = KDColor::blend(pixels[i], color, mask[i]) */
+  static void BlendWithMask(KDColor * pixels, KDColor color, const uint8_t * mask, size_t length);
+  static const char * ImplementationName();
+};
+
+#endif
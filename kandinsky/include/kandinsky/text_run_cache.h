@@ -0,0 +1,84 @@
+#ifndef KANDINSKY_TEXT_RUN_CACHE_H
+#define KANDINSKY_TEXT_RUN_CACHE_H
+
+#include <kandinsky/color.h>
+#include <kandinsky/font.h>
+#include <kandinsky/size.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* KDTextRunCache keeps fully rendered single-line strings around so that
+ * labels which are redrawn at every frame (axis graduations, banner titles,
+ * column titles...) skip UTF-8 decoding, glyph lookup, decompression and
+ * colorization altogether.
+ *
+ * A run is identified by its text, font and colors. The pixels of the runs and
+ * their text are stored back to back in a fixed-size pool, used as a ring
+ * buffer: allocating a new run evicts the oldest runs it overlaps.
+ *
+ * The cache is only used on the simulator: on the device, a pool holding the
+ * labels it is meant for would take a large share of the RAM. */
+
+class KDTextRunCache {
+public:
+  static KDTextRunCache * sharedCache();
+
+  constexpr static size_t k_poolSize = 65536; // Bytes
+  constexpr static int k_numberOfRuns = 32;
+  constexpr static size_t k_maxTextLength = 32; // Bytes
+
+  struct Statistics {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+  };
+
+  KDTextRunCache();
+  // A disabled cache neither finds nor keeps any run
+  void setEnabled(bool enabled) { m_enabled = enabled; }
+  /* Return the rendered pixels of the run, or nullptr if it is not cached.
+   * The pixels remain valid until the next call to allocateRun. */
+  const KDColor * pixelsForRun(const char * text, size_t textLength, const KDFont * font, KDColor textColor, KDColor backgroundColor);
+  /* Reserve a run of the given size and return the pixel buffer the caller
+   * must render the string into, or nullptr if the run cannot be cached. */
+  KDColor * allocateRun(const char * text, size_t textLength, const KDFont * font, KDColor textColor, KDColor backgroundColor, KDSize size);
+  /* Buffer big enough for the pixels of any run, in which clipped runs are
+   * gathered before being pushed at once. */
+  KDColor * workingBuffer() { return m_workingBuffer; }
+  Statistics statistics() const { return m_statistics; }
+  void reset();
+
+private:
+  constexpr static size_t k_poolCapacity = k_poolSize/sizeof(KDColor);
+  /* A single run is not allowed to take more than a quarter of the pool,
+   * otherwise a long string would flush every other run at once. */
+  constexpr static size_t k_maxRunLength = k_poolCapacity/4;
+  struct Run {
+    bool isValid() const { return font != nullptr; }
+    bool overlaps(size_t poolStart, size_t poolEnd) const { return isValid() && start < poolEnd && poolStart < start + length; }
+    uint32_t hash;
+    const KDFont * font;
+    uint16_t textColor;
+    uint16_t backgroundColor;
+    uint16_t textLength;
+    uint16_t start; // In pool units
+    uint16_t length; // In pool units
+  };
+  static_assert(k_poolCapacity <= UINT16_MAX, "Run offsets must fit in a uint16_t");
+  static uint32_t Hash(const char * text, size_t textLength);
+  static size_t PoolLength(size_t numberOfPixels, size_t textLength) {
+    return numberOfPixels + (textLength + sizeof(KDColor) - 1)/sizeof(KDColor);
+  }
+  const char * textOfRun(const Run * run) const { return reinterpret_cast<const char *>(m_pool + run->start + run->length) - run->textLength; }
+  void evict(Run * run);
+
+  KDColor m_pool[k_poolCapacity];
+  KDColor m_workingBuffer[k_maxRunLength];
+  Run m_runs[k_numberOfRuns];
+  size_t m_poolHead;
+  int m_nextRun;
+  Statistics m_statistics;
+  bool m_enabled;
+};
+
+#endif
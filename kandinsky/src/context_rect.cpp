@@ -1,4 +1,5 @@
 #include <kandinsky/context.h>
+#include <kandinsky/pixel_run.h>
 #include <assert.h>
 
 KDRect KDContext::absoluteFillRect(KDRect rect) {
@@ -51,9 +52,10 @@ void KDContext::fillRectWithPixels(KDRect rect, const KDColor * pixels, KDColor
     }
   } else {
     for (KDCoordinate j=0; j<absoluteRect.height(); j++) {
-      for (KDCoordinate i=0; i<absoluteRect.width(); i++) {
-        workingBuffer[i+absoluteRect.width()*j] = pixels[startingI+i+rect.width()*(startingJ+j)];
-      }
+      KDPixelRun::Copy(
+          workingBuffer + absoluteRect.width()*j,
+          pixels + startingI + rect.width()*(startingJ+j),
+          absoluteRect.width());
     }
     pushRect(absoluteRect, workingBuffer);
   }
@@ -76,12 +78,11 @@ void KDContext::blendRectWithMask(KDRect rect, KDColor color, const uint8_t * ma
   startingI = startingI > 0 ? startingI : 0;
   startingJ = startingJ > 0 ? startingJ : 0;
   for (KDCoordinate j=0; j<absoluteRect.height(); j++) {
-    for (KDCoordinate i=0; i<absoluteRect.width(); i++) {
-      KDColor * currentPixelAdress = workingBuffer + i + absoluteRect.width()*j;
-      const uint8_t * currentMaskAddress = mask + i + startingI + rect.width()*(j + startingJ);
-      *currentPixelAdress = KDColor::blend(*currentPixelAdress, color, *currentMaskAddress);
-      //*currentPixelAdress = KDColorBlend(*currentPixelAdress, color, *currentMaskAddress);
-    }
+    KDPixelRun::BlendWithMask(
+        workingBuffer + absoluteRect.width()*j,
+        color,
+        mask + startingI + rect.width()*(j + startingJ),
+        absoluteRect.width());
   }
   pushRect(absoluteRect, workingBuffer);
 }
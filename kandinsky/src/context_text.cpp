@@ -1,6 +1,8 @@
 #include <assert.h>
 #include <kandinsky/context.h>
 #include <kandinsky/font.h>
+#include <kandinsky/pixel_run.h>
+#include <kandinsky/text_run_cache.h>
 #include <ion/unicode/utf8_decoder.h>
 #include <ion/display.h>
 #include <cmath>
@@ -45,7 +47,52 @@ KDPoint KDContext::alignAndDrawString(const char * text, KDPoint p, KDSize frame
                                       textColor, backgroundColor, maxLength + text - startLine);
 }
 
+#if !PLATFORM_DEVICE
+static bool isCacheableRun(const char * text, int maxByteLength, size_t * textLength) {
+  size_t length = 0;
+  while ((maxByteLength < 0 || length < static_cast<size_t>(maxByteLength)) && text[length] != 0) {
+    char c = text[length];
+    if (c == UCodePointLineFeed || c == UCodePointCarriageReturn || c == UCodePointTabulation || length >= KDTextRunCache::k_maxTextLength) {
+      return false;
+    }
+    length++;
+  }
+  /* The last drawn code point may extend past maxByteLength, and be followed
+   * by combining code points: only cut runs right before an ASCII char. */
+  if (static_cast<uint8_t>(text[length]) >= 0x80) {
+    return false;
+  }
+  *textLength = length;
+  return true;
+}
+#endif
+
 KDPoint KDContext::drawString(const char * text, KDPoint p, const KDFont * font, KDColor textColor, KDColor backgroundColor, int maxByteLength) {
+#if !PLATFORM_DEVICE
+  size_t textLength;
+  if (isCacheableRun(text, maxByteLength, &textLength)) {
+    KDSize runSize = font->stringSize(text, textLength);
+    KDRect runRect(p, runSize);
+    KDPoint endPosition = p.translatedBy(KDPoint(runSize.width(), 0));
+    if (absoluteFillRect(runRect).isEmpty()) {
+      return endPosition;
+    }
+    KDTextRunCache * cache = KDTextRunCache::sharedCache();
+    const KDColor * runPixels = cache->pixelsForRun(text, textLength, font, textColor, backgroundColor);
+    if (runPixels == nullptr) {
+      KDColor * runBuffer = cache->allocateRun(text, textLength, font, textColor, backgroundColor, runSize);
+      if (runBuffer != nullptr) {
+        renderSingleLineString(text, textLength, font, textColor, backgroundColor, runBuffer, runSize.width());
+        runPixels = runBuffer;
+      }
+    }
+    if (runPixels != nullptr) {
+      fillRectWithPixels(runRect, runPixels, cache->workingBuffer());
+      return endPosition;
+    }
+  }
+#endif
+
   KDPoint position = p;
   KDSize glyphSize = font->glyphSize();
   KDFont::RenderPalette palette = font->renderPalette(textColor, backgroundColor);
@@ -87,3 +134,31 @@ KDPoint KDContext::drawString(const char * text, KDPoint p, const KDFont * font,
   }
   return position;
 }
+
+void KDContext::renderSingleLineString(const char * text, size_t textLength, const KDFont * font, KDColor textColor, KDColor backgroundColor, KDColor * pixels, KDCoordinate runWidth) {
+  KDSize glyphSize = font->glyphSize();
+  KDFont::RenderPalette palette = font->renderPalette(textColor, backgroundColor);
+  KDFont::GlyphBuffer glyphBuffer;
+  KDCoordinate x = 0;
+
+  UTF8Decoder decoder(text);
+  const char * codePointPointer = decoder.stringPosition();
+  CodePoint codePoint = decoder.nextCodePoint();
+  while (codePoint != UCodePointNull && codePointPointer < text + textLength) {
+    assert(!codePoint.isCombining());
+    font->setGlyphGrayscalesForCodePoint(codePoint, &glyphBuffer);
+    codePointPointer = decoder.stringPosition();
+    codePoint = decoder.nextCodePoint();
+    while (codePoint.isCombining()) {
+      font->accumulateGlyphGrayscalesForCodePoint(codePoint, &glyphBuffer);
+      codePointPointer = decoder.stringPosition();
+      codePoint = decoder.nextCodePoint();
+    }
+    font->colorizeGlyphBuffer(&palette, &glyphBuffer);
+    assert(x + glyphSize.width() <= runWidth);
+    for (KDCoordinate j = 0; j < glyphSize.height(); j++) {
+      KDPixelRun::Copy(pixels + j*runWidth + x, glyphBuffer.colorBuffer() + j*glyphSize.width(), glyphSize.width());
+    }
+    x += glyphSize.width();
+  }
+}
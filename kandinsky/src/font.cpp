@@ -90,7 +90,7 @@ void KDFont::colorizeGlyphBuffer(const RenderPalette * renderPalette, GlyphBuffe
   }
 }
 
-KDFont::GlyphIndex KDFont::indexForCodePoint(CodePoint c) const {
+KDFont::GlyphIndex KDFont::indexForCodePointInTable(CodePoint c) const {
 #define USE_BINARY_SEARCH 0
 #if USE_BINARY_SEARCH
   int lowerBound = 0;
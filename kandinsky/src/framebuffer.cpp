@@ -1,5 +1,5 @@
 #include <kandinsky/framebuffer.h>
-#include <string.h>
+#include <kandinsky/pixel_run.h>
 
 KDFrameBuffer::KDFrameBuffer(KDColor * pixels, KDSize size) :
   m_pixels(pixels),
@@ -16,39 +16,44 @@ KDColor * KDFrameBuffer::pixelAddress(KDPoint p) const {
 }
 
 void KDFrameBuffer::pushRect(KDRect rect, const KDColor * pixels) {
+  if (rect.width() == m_size.width()) {
+    // Full-width rows are contiguous in the framebuffer
+    KDPixelRun::Copy(pixelAddress(rect.origin()), pixels, rect.width()*rect.height());
+    return;
+  }
   const KDColor * line = pixels;
+  KDColor * pixel = pixelAddress(rect.origin());
   for (KDCoordinate j=0; j<rect.height(); j++) {
-    KDPoint lineOffset = KDPoint(0, j);
-    memcpy(pixelAddress(rect.origin().translatedBy(lineOffset)),
-        line,
-        rect.width()*sizeof(KDColor));
+    KDPixelRun::Copy(pixel, line, rect.width());
     line += rect.width();
+    pixel += m_size.width();
   }
 }
 
 void KDFrameBuffer::pushRectUniform(KDRect rect, KDColor color) {
   // Caution: this code is used very frequently
   // It's worth optimizing!
+  if (rect.width() == m_size.width()) {
+    KDPixelRun::Fill(pixelAddress(rect.origin()), color, rect.width()*rect.height());
+    return;
+  }
   KDColor * pixel = pixelAddress(rect.origin());
-  int lineDelta = m_size.width() - rect.width();
   for (KDCoordinate j=0; j<rect.height(); j++) {
-    //KDColor * topLeftPixelAddress = pixelAddress(rect.origin().translatedBy(KDPoint(0,j)));
-    //*pixelAddress(rect.origin().translatedBy(KDPoint(i,j))) = color;
-    for (KDCoordinate i=0; i<rect.width(); i++) {
-      *pixel++ = color;
-      //*pixelAddress(rect.origin().translatedBy(KDPoint(i,j))) = color;
-    }
-    pixel += lineDelta;
+    KDPixelRun::Fill(pixel, color, rect.width());
+    pixel += m_size.width();
   }
 }
 
 void KDFrameBuffer::pullRect(KDRect rect, KDColor * pixels) {
+  if (rect.width() == m_size.width()) {
+    KDPixelRun::Copy(pixels, pixelAddress(rect.origin()), rect.width()*rect.height());
+    return;
+  }
   KDColor * line = pixels;
+  const KDColor * pixel = pixelAddress(rect.origin());
   for (KDCoordinate j=0; j<rect.height(); j++) {
-    KDPoint lineOffset = KDPoint(0, j);
-    memcpy(line,
-        pixelAddress(rect.origin().translatedBy(lineOffset)),
-        rect.width()*sizeof(KDColor));
+    KDPixelRun::Copy(line, pixel, rect.width());
     line += rect.width();
+    pixel += m_size.width();
   }
 }
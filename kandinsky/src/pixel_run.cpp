@@ -0,0 +1,257 @@
+#include <kandinsky/pixel_run.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#define KD_PIXEL_RUN_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define KD_PIXEL_RUN_NEON 1
+#include <arm_neon.h>
+#elif defined(__ARM_FEATURE_DSP)
+#define KD_PIXEL_RUN_DSP 1
+#endif
+
+/* Blending a pixel p with a color c through an alpha value a comes down to
+ * computing, on each RGB565 component:
+ *   (p * a + c * (0x100 - a)) >> 8
+ * This is exactly what KDColor::blend does once the 8-bit expansion of the
+ * components has been simplified out. KDColor::blend returns p untouched when
+ * a = 0xFF: using a weight of 0x100 instead of 0xFF yields the same result
+ * without branching. Every intermediate value fits in 16 bits. */
+
+#if KD_PIXEL_RUN_SSE2
+
+static constexpr size_t k_pixelsPerVector = 8;
+
+void KDPixelRun::Fill(KDColor * pixels, KDColor color, size_t length) {
+  __m128i colors = _mm_set1_epi16(static_cast<uint16_t>(color));
+  size_t i = 0;
+  for (; i + k_pixelsPerVector <= length; i += k_pixelsPerVector) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + i), colors);
+  }
+  for (; i < length; i++) {
+    pixels[i] = color;
+  }
+}
+
+void KDPixelRun::Copy(KDColor * destination, const KDColor * source, size_t length) {
+  size_t i = 0;
+  for (; i + k_pixelsPerVector <= length; i += k_pixelsPerVector) {
+    __m128i colors = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i), colors);
+  }
+  for (; i < length; i++) {
+    destination[i] = source[i];
+  }
+}
+
+void KDPixelRun::BlendWithMask(KDColor * pixels, KDColor color, const uint8_t * mask, size_t length) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i opaque = _mm_set1_epi16(0xFF);
+  const __m128i one = _mm_set1_epi16(0x100);
+  const __m128i mask5 = _mm_set1_epi16(0x1F);
+  const __m128i mask6 = _mm_set1_epi16(0x3F);
+  const __m128i colorRed = _mm_set1_epi16(static_cast<uint16_t>(color) >> 11);
+  const __m128i colorGreen = _mm_set1_epi16((static_cast<uint16_t>(color) >> 5) & 0x3F);
+  const __m128i colorBlue = _mm_set1_epi16(static_cast<uint16_t>(color) & 0x1F);
+  size_t i = 0;
+  for (; i + k_pixelsPerVector <= length; i += k_pixelsPerVector) {
+    __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels + i));
+    __m128i alpha = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mask + i)), zero);
+    // alpha - (-1) = 0x100 where alpha == 0xFF
+    alpha = _mm_sub_epi16(alpha, _mm_cmpeq_epi16(alpha, opaque));
+    __m128i oneMinusAlpha = _mm_sub_epi16(one, alpha);
+    __m128i red = _mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(p, 11), alpha), _mm_mullo_epi16(colorRed, oneMinusAlpha));
+    __m128i green = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(p, 5), mask6), alpha), _mm_mullo_epi16(colorGreen, oneMinusAlpha));
+    __m128i blue = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(p, mask5), alpha), _mm_mullo_epi16(colorBlue, oneMinusAlpha));
+    __m128i result = _mm_or_si128(
+        _mm_or_si128(_mm_slli_epi16(_mm_srli_epi16(red, 8), 11), _mm_slli_epi16(_mm_srli_epi16(green, 8), 5)),
+        _mm_srli_epi16(blue, 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + i), result);
+  }
+  for (; i < length; i++) {
+    pixels[i] = KDColor::blend(pixels[i], color, mask[i]);
+  }
+}
+
+const char * KDPixelRun::ImplementationName() {
+  return "SSE2";
+}
+
+#elif KD_PIXEL_RUN_NEON
+
+static constexpr size_t k_pixelsPerVector = 8;
+
+void KDPixelRun::Fill(KDColor * pixels, KDColor color, size_t length) {
+  uint16x8_t colors = vdupq_n_u16(static_cast<uint16_t>(color));
+  size_t i = 0;
+  for (; i + k_pixelsPerVector <= length; i += k_pixelsPerVector) {
+    vst1q_u16(reinterpret_cast<uint16_t *>(pixels + i), colors);
+  }
+  for (; i < length; i++) {
+    pixels[i] = color;
+  }
+}
+
+void KDPixelRun::Copy(KDColor * destination, const KDColor * source, size_t length) {
+  size_t i = 0;
+  for (; i + k_pixelsPerVector <= length; i += k_pixelsPerVector) {
+    vst1q_u16(reinterpret_cast<uint16_t *>(destination + i), vld1q_u16(reinterpret_cast<const uint16_t *>(source + i)));
+  }
+  for (; i < length; i++) {
+    destination[i] = source[i];
+  }
+}
+
+void KDPixelRun::BlendWithMask(KDColor * pixels, KDColor color, const uint8_t * mask, size_t length) {
+  const uint16x8_t opaque = vdupq_n_u16(0xFF);
+  const uint16x8_t one = vdupq_n_u16(0x100);
+  const uint16x8_t mask5 = vdupq_n_u16(0x1F);
+  const uint16x8_t mask6 = vdupq_n_u16(0x3F);
+  const uint16x8_t colorRed = vdupq_n_u16(static_cast<uint16_t>(color) >> 11);
+  const uint16x8_t colorGreen = vdupq_n_u16((static_cast<uint16_t>(color) >> 5) & 0x3F);
+  const uint16x8_t colorBlue = vdupq_n_u16(static_cast<uint16_t>(color) & 0x1F);
+  size_t i = 0;
+  for (; i + k_pixelsPerVector <= length; i += k_pixelsPerVector) {
+    uint16x8_t p = vld1q_u16(reinterpret_cast<const uint16_t *>(pixels + i));
+    uint16x8_t alpha = vmovl_u8(vld1_u8(mask + i));
+    // alpha - 0xFFFF = 0x100 where alpha == 0xFF
+    alpha = vsubq_u16(alpha, vceqq_u16(alpha, opaque));
+    uint16x8_t oneMinusAlpha = vsubq_u16(one, alpha);
+    uint16x8_t red = vmlaq_u16(vmulq_u16(colorRed, oneMinusAlpha), vshrq_n_u16(p, 11), alpha);
+    uint16x8_t green = vmlaq_u16(vmulq_u16(colorGreen, oneMinusAlpha), vandq_u16(vshrq_n_u16(p, 5), mask6), alpha);
+    uint16x8_t blue = vmlaq_u16(vmulq_u16(colorBlue, oneMinusAlpha), vandq_u16(p, mask5), alpha);
+    uint16x8_t result = vorrq_u16(
+        vorrq_u16(vshlq_n_u16(vshrq_n_u16(red, 8), 11), vshlq_n_u16(vshrq_n_u16(green, 8), 5)),
+        vshrq_n_u16(blue, 8));
+    vst1q_u16(reinterpret_cast<uint16_t *>(pixels + i), result);
+  }
+  for (; i < length; i++) {
+    pixels[i] = KDColor::blend(pixels[i], color, mask[i]);
+  }
+}
+
+const char * KDPixelRun::ImplementationName() {
+  return "NEON";
+}
+
+#elif KD_PIXEL_RUN_DSP
+
+/* Cortex-M cores move two pixels per 32-bit access, and the DSP extension's
+ * SMUAD computes a dual 16-bit multiply-accumulate, i.e. the whole
+ * p * a + c * (0x100 - a) of one component, in a single cycle. */
+
+typedef uint32_t __attribute__((__may_alias__)) PixelPair;
+
+static inline uint32_t smuad(uint32_t x, uint32_t y) {
+  uint32_t result;
+  asm ("smuad %0, %1, %2" : "=r" (result) : "r" (x), "r" (y));
+  return result;
+}
+
+static inline bool isWordAligned(const void * address) {
+  return (reinterpret_cast<uintptr_t>(address) & 0x3) == 0;
+}
+
+void KDPixelRun::Fill(KDColor * pixels, KDColor color, size_t length) {
+  if (length > 0 && !isWordAligned(pixels)) {
+    *pixels++ = color;
+    length--;
+  }
+  uint32_t pair = static_cast<uint16_t>(color) | (static_cast<uint32_t>(static_cast<uint16_t>(color)) << 16);
+  PixelPair * pairs = reinterpret_cast<PixelPair *>(pixels);
+  size_t numberOfPairs = length / 2;
+  size_t i = 0;
+  for (; i + 4 <= numberOfPairs; i += 4) {
+    pairs[i] = pair;
+    pairs[i+1] = pair;
+    pairs[i+2] = pair;
+    pairs[i+3] = pair;
+  }
+  for (; i < numberOfPairs; i++) {
+    pairs[i] = pair;
+  }
+  if (length % 2) {
+    pixels[length - 1] = color;
+  }
+}
+
+void KDPixelRun::Copy(KDColor * destination, const KDColor * source, size_t length) {
+  if (isWordAligned(destination) != isWordAligned(source)) {
+    for (size_t i = 0; i < length; i++) {
+      destination[i] = source[i];
+    }
+    return;
+  }
+  if (length > 0 && !isWordAligned(destination)) {
+    *destination++ = *source++;
+    length--;
+  }
+  PixelPair * destinationPairs = reinterpret_cast<PixelPair *>(destination);
+  const PixelPair * sourcePairs = reinterpret_cast<const PixelPair *>(source);
+  size_t numberOfPairs = length / 2;
+  size_t i = 0;
+  for (; i + 4 <= numberOfPairs; i += 4) {
+    destinationPairs[i] = sourcePairs[i];
+    destinationPairs[i+1] = sourcePairs[i+1];
+    destinationPairs[i+2] = sourcePairs[i+2];
+    destinationPairs[i+3] = sourcePairs[i+3];
+  }
+  for (; i < numberOfPairs; i++) {
+    destinationPairs[i] = sourcePairs[i];
+  }
+  if (length % 2) {
+    destination[length - 1] = source[length - 1];
+  }
+}
+
+void KDPixelRun::BlendWithMask(KDColor * pixels, KDColor color, const uint8_t * mask, size_t length) {
+  // Each component of color sits in the top half-word, facing 0x100 - alpha
+  uint32_t colorRed = static_cast<uint32_t>(static_cast<uint16_t>(color) >> 11) << 16;
+  uint32_t colorGreen = static_cast<uint32_t>((static_cast<uint16_t>(color) >> 5) & 0x3F) << 16;
+  uint32_t colorBlue = static_cast<uint32_t>(static_cast<uint16_t>(color) & 0x1F) << 16;
+  for (size_t i = 0; i < length; i++) {
+    uint32_t alpha = mask[i];
+    if (alpha == 0) {
+      pixels[i] = color;
+      continue;
+    }
+    if (alpha == 0xFF) {
+      continue;
+    }
+    uint32_t weights = alpha | ((0x100 - alpha) << 16);
+    uint16_t p = pixels[i];
+    uint32_t red = smuad((p >> 11) | colorRed, weights) >> 8;
+    uint32_t green = smuad(((p >> 5) & 0x3F) | colorGreen, weights) >> 8;
+    uint32_t blue = smuad((p & 0x1F) | colorBlue, weights) >> 8;
+    pixels[i] = KDColor::RGB16(red << 11 | green << 5 | blue);
+  }
+}
+
+const char * KDPixelRun::ImplementationName() {
+  return "DSP";
+}
+
+#else
+
+void KDPixelRun::Fill(KDColor * pixels, KDColor color, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    pixels[i] = color;
+  }
+}
+
+void KDPixelRun::Copy(KDColor * destination, const KDColor * source, size_t length) {
+  memmove(destination, source, length * sizeof(KDColor));
+}
+
+void KDPixelRun::BlendWithMask(KDColor * pixels, KDColor color, const uint8_t * mask, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    pixels[i] = KDColor::blend(pixels[i], color, mask[i]);
+  }
+}
+
+const char * KDPixelRun::ImplementationName() {
+  return "Scalar";
+}
+
+#endif
@@ -0,0 +1,94 @@
+#include <kandinsky/text_run_cache.h>
+#include <assert.h>
+#include <string.h>
+
+KDTextRunCache * KDTextRunCache::sharedCache() {
+  static KDTextRunCache cache;
+  return &cache;
+}
+
+KDTextRunCache::KDTextRunCache() :
+  m_enabled(true)
+{
+  reset();
+}
+
+void KDTextRunCache::reset() {
+  for (int i = 0; i < k_numberOfRuns; i++) {
+    m_runs[i].font = nullptr;
+  }
+  m_poolHead = 0;
+  m_nextRun = 0;
+  m_statistics = {0, 0, 0};
+}
+
+uint32_t KDTextRunCache::Hash(const char * text, size_t textLength) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < textLength; i++) {
+    hash = (hash ^ static_cast<uint8_t>(text[i])) * 16777619u;
+  }
+  return hash;
+}
+
+const KDColor * KDTextRunCache::pixelsForRun(const char * text, size_t textLength, const KDFont * font, KDColor textColor, KDColor backgroundColor) {
+  if (!m_enabled || textLength > k_maxTextLength) {
+    return nullptr;
+  }
+  uint32_t hash = Hash(text, textLength);
+  for (int i = 0; i < k_numberOfRuns; i++) {
+    const Run * run = m_runs + i;
+    if (run->hash == hash
+        && run->font == font
+        && run->textLength == textLength
+        && run->textColor == textColor
+        && run->backgroundColor == backgroundColor
+        && memcmp(textOfRun(run), text, textLength) == 0) {
+      m_statistics.hits++;
+      return m_pool + run->start;
+    }
+  }
+  m_statistics.misses++;
+  return nullptr;
+}
+
+KDColor * KDTextRunCache::allocateRun(const char * text, size_t textLength, const KDFont * font, KDColor textColor, KDColor backgroundColor, KDSize size) {
+  assert(font != nullptr);
+  if (!m_enabled || textLength > k_maxTextLength) {
+    return nullptr;
+  }
+  size_t length = PoolLength(size.width() * size.height(), textLength);
+  if (length > k_maxRunLength) {
+    return nullptr;
+  }
+  if (m_poolHead + length > k_poolCapacity) {
+    m_poolHead = 0;
+  }
+  for (int i = 0; i < k_numberOfRuns; i++) {
+    if (m_runs[i].overlaps(m_poolHead, m_poolHead + length)) {
+      evict(m_runs + i);
+    }
+  }
+  Run * run = m_runs + m_nextRun;
+  if (run->isValid()) {
+    evict(run);
+  }
+  m_nextRun = (m_nextRun + 1) % k_numberOfRuns;
+
+  run->hash = Hash(text, textLength);
+  run->font = font;
+  run->textColor = textColor;
+  run->backgroundColor = backgroundColor;
+  run->textLength = textLength;
+  run->start = m_poolHead;
+  run->length = length;
+  memcpy(const_cast<char *>(textOfRun(run)), text, textLength);
+  m_poolHead += length;
+  return m_pool + run->start;
+}
+
+void KDTextRunCache::evict(Run * run) {
+  assert(run->isValid());
+  run->font = nullptr;
+  m_statistics.evictions++;
+}
@@ -9,7 +9,7 @@ static constexpr KDFont::CodePointIndexPair table[] = {
   KDFont::CodePointIndexPair(14, 7)
 };
 
-constexpr KDFont testFont(4, table, 10, 10, nullptr, nullptr);
+constexpr KDFont testFont(4, table, nullptr, nullptr, 10, 10, nullptr, nullptr);
 
 constexpr int numberOfTests = 16;
 const KDFont::GlyphIndex index_for_code_point[numberOfTests] = {
@@ -37,3 +37,21 @@ QUIZ_CASE(kandinsky_font_index_for_code_point) {
     quiz_assert(result == index_for_code_point[i]);
   }
 }
+
+// Defined in kandinsky/fonts/code_points.h
+extern "C" uint32_t CodePoints[];
+extern "C" int NumberOfCodePoints;
+
+QUIZ_CASE(kandinsky_font_glyph_pages) {
+  const KDFont * fonts[] = {KDFont::LargeFont, KDFont::SmallFont};
+  for (const KDFont * font : fonts) {
+    // Direct lookups must agree with the code point index pairs
+    for (uint32_t c = 0; c < 0x10000; c++) {
+      quiz_assert(font->indexForCodePoint(c) == font->indexForCodePointInTable(c));
+    }
+    for (int i = 0; i < NumberOfCodePoints; i++) {
+      quiz_assert(font->indexForCodePoint(CodePoints[i]) == i);
+    }
+    quiz_assert(font->indexForCodePoint(0x1F600) == KDFont::IndexForReplacementCharacterCodePoint);
+  }
+}
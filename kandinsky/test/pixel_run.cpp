@@ -0,0 +1,71 @@
+#include <quiz.h>
+#include <kandinsky/pixel_run.h>
+
+constexpr static size_t k_runLength = 320;
+// Odd offsets exercise unaligned heads and tails
+constexpr static size_t k_offsets[] = {0, 1, 2, 3, 7};
+constexpr static size_t k_lengths[] = {0, 1, 2, 7, 8, 9, 15, 16, 17, 63, 300};
+
+static KDColor pseudoRandomColor(size_t i) {
+  return KDColor::RGB16(static_cast<uint16_t>(i * 40503u + 0x1234));
+}
+
+QUIZ_CASE(kandinsky_pixel_run_fill) {
+  KDColor pixels[k_runLength];
+  KDColor color = KDColor::RGB24(0x123456);
+  for (size_t offset : k_offsets) {
+    for (size_t length : k_lengths) {
+      KDPixelRun::Fill(pixels, KDColorBlack, k_runLength);
+      KDPixelRun::Fill(pixels + offset, color, length);
+      for (size_t i = 0; i < k_runLength; i++) {
+        bool inRun = i >= offset && i < offset + length;
+        quiz_assert(pixels[i] == (inRun ? color : KDColorBlack));
+      }
+    }
+  }
+}
+
+QUIZ_CASE(kandinsky_pixel_run_copy) {
+  KDColor source[k_runLength];
+  KDColor destination[k_runLength];
+  for (size_t i = 0; i < k_runLength; i++) {
+    source[i] = pseudoRandomColor(i);
+  }
+  for (size_t sourceOffset : k_offsets) {
+    for (size_t destinationOffset : k_offsets) {
+      for (size_t length : k_lengths) {
+        KDPixelRun::Fill(destination, KDColorBlack, k_runLength);
+        KDPixelRun::Copy(destination + destinationOffset, source + sourceOffset, length);
+        for (size_t i = 0; i < k_runLength; i++) {
+          bool inRun = i >= destinationOffset && i < destinationOffset + length;
+          quiz_assert(destination[i] == (inRun ? source[i - destinationOffset + sourceOffset] : KDColorBlack));
+        }
+      }
+    }
+  }
+
+  // Overlapping copy towards the start of the buffer
+  KDPixelRun::Copy(source, source + 3, k_runLength - 3);
+  for (size_t i = 0; i < k_runLength - 3; i++) {
+    quiz_assert(source[i] == pseudoRandomColor(i + 3));
+  }
+}
+
+QUIZ_CASE(kandinsky_pixel_run_blend_with_mask) {
+  constexpr size_t numberOfAlphas = 256;
+  KDColor pixels[numberOfAlphas + 7];
+  uint8_t mask[numberOfAlphas + 7];
+  const KDColor colors[] = {KDColorBlack, KDColorWhite, KDColorRed, KDColor::RGB24(0x7F3A91)};
+  for (KDColor color : colors) {
+    for (size_t offset : k_offsets) {
+      for (size_t i = 0; i < numberOfAlphas; i++) {
+        pixels[offset + i] = pseudoRandomColor(i);
+        mask[offset + i] = i;
+      }
+      KDPixelRun::BlendWithMask(pixels + offset, color, mask + offset, numberOfAlphas);
+      for (size_t i = 0; i < numberOfAlphas; i++) {
+        quiz_assert(pixels[offset + i] == KDColor::blend(pseudoRandomColor(i), color, i));
+      }
+    }
+  }
+}
@@ -0,0 +1,107 @@
+#include <quiz.h>
+#include <kandinsky/framebuffer.h>
+#include <kandinsky/framebuffer_context.h>
+#include <kandinsky/text_run_cache.h>
+
+constexpr static KDCoordinate k_width = 80;
+constexpr static KDCoordinate k_height = 40;
+
+static void drawInBuffer(KDColor * pixels, const char * text, KDPoint p, const KDFont * font) {
+  for (int i = 0; i < k_width*k_height; i++) {
+    pixels[i] = KDColorWhite;
+  }
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  KDFrameBufferContext context(&frameBuffer);
+  context.drawString(text, p, font, KDColorBlack, KDColorWhite);
+}
+
+static bool buffersAreEqual(const KDColor * a, const KDColor * b) {
+  for (int i = 0; i < k_width*k_height; i++) {
+    if (a[i] != b[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+QUIZ_CASE(kandinsky_text_run_cache_hit) {
+  KDTextRunCache * cache = KDTextRunCache::sharedCache();
+  cache->reset();
+  KDColor first[k_width*k_height];
+  KDColor second[k_width*k_height];
+  drawInBuffer(first, "x=-12", KDPoint(3, 5), KDFont::SmallFont);
+  quiz_assert(cache->statistics().misses == 1 && cache->statistics().hits == 0);
+  drawInBuffer(second, "x=-12", KDPoint(3, 5), KDFont::SmallFont);
+  quiz_assert(cache->statistics().misses == 1 && cache->statistics().hits == 1);
+  quiz_assert(buffersAreEqual(first, second));
+
+  // Same text, different font or colors are different runs
+  drawInBuffer(second, "x=-12", KDPoint(3, 5), KDFont::LargeFont);
+  quiz_assert(cache->statistics().misses == 2);
+  quiz_assert(!buffersAreEqual(first, second));
+
+  // Clipped runs are drawn from the cached pixels
+  drawInBuffer(first, "x=-12", KDPoint(-4, 30), KDFont::SmallFont);
+  quiz_assert(cache->statistics().hits == 2);
+  cache->reset();
+  drawInBuffer(second, "x=-12", KDPoint(-4, 30), KDFont::SmallFont);
+  quiz_assert(cache->statistics().misses == 1);
+  quiz_assert(buffersAreEqual(first, second));
+
+  // Runs out of the clipping rect are neither drawn nor cached
+  drawInBuffer(first, "Hidden", KDPoint(k_width, 0), KDFont::SmallFont);
+  quiz_assert(cache->statistics().misses == 1);
+
+  // Multi-line strings bypass the cache
+  drawInBuffer(first, "a\nb", KDPointZero, KDFont::SmallFont);
+  quiz_assert(cache->statistics().misses == 1 && cache->statistics().hits == 0);
+  cache->reset();
+}
+
+static void assert_cached_run_is_drawn_as_uncached(const char * text, KDPoint p, const KDFont * font) {
+  KDTextRunCache * cache = KDTextRunCache::sharedCache();
+  KDColor uncached[k_width*k_height];
+  KDColor cached[k_width*k_height];
+  cache->reset();
+  cache->setEnabled(false);
+  drawInBuffer(uncached, text, p, font);
+  cache->setEnabled(true);
+  // The first drawing fills the cache, the second one is a hit
+  drawInBuffer(cached, text, p, font);
+  quiz_assert(buffersAreEqual(cached, uncached));
+  drawInBuffer(cached, text, p, font);
+  quiz_assert(cache->statistics().hits == 1);
+  quiz_assert(buffersAreEqual(cached, uncached));
+  cache->reset();
+}
+
+QUIZ_CASE(kandinsky_text_run_cache_pixels) {
+  assert_cached_run_is_drawn_as_uncached("y=2.5", KDPoint(3, 5), KDFont::SmallFont);
+  assert_cached_run_is_drawn_as_uncached("Abc", KDPoint(10, 12), KDFont::LargeFont);
+  // Clipped on each side
+  assert_cached_run_is_drawn_as_uncached("-0.25", KDPoint(-6, 3), KDFont::SmallFont);
+  assert_cached_run_is_drawn_as_uncached("-0.25", KDPoint(k_width - 20, 3), KDFont::LargeFont);
+  assert_cached_run_is_drawn_as_uncached("-0.25", KDPoint(2, -7), KDFont::SmallFont);
+  assert_cached_run_is_drawn_as_uncached("-0.25", KDPoint(2, k_height - 9), KDFont::LargeFont);
+}
+
+QUIZ_CASE(kandinsky_text_run_cache_eviction) {
+  KDTextRunCache * cache = KDTextRunCache::sharedCache();
+  cache->reset();
+  KDColor pixels[k_width*k_height];
+  char text[] = "A";
+  int numberOfRuns = 0;
+  // Fill the cache until either the pool or the run slots are exhausted
+  while (cache->statistics().evictions == 0) {
+    text[0] = 'A' + numberOfRuns++;
+    drawInBuffer(pixels, text, KDPointZero, KDFont::LargeFont);
+  }
+  quiz_assert(numberOfRuns <= KDTextRunCache::k_numberOfRuns + 1);
+  quiz_assert(cache->statistics().evictions == 1);
+  // The oldest run was evicted, the newest one is still there
+  drawInBuffer(pixels, text, KDPointZero, KDFont::LargeFont);
+  quiz_assert(cache->statistics().hits == 1);
+  drawInBuffer(pixels, "A", KDPointZero, KDFont::LargeFont);
+  quiz_assert(cache->statistics().hits == 1);
+  cache->reset();
+}
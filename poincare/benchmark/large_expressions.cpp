@@ -0,0 +1,90 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <poincare/test/helper.h>
+#include <stdio.h>
+#include <string.h>
+
+QUIZ_CASE(poincare_large_matrices_benchmark) {
+  /* Approximating matrix functions reads every coefficient of the matrices:
+   * they should be walked in order, not fetched one by one by index. */
+  constexpr int bufferSize = 512;
+  char matrix[bufferSize];
+  // Large enough for any matrix written twice in the expressions below
+  constexpr int expressionSize = 2 * bufferSize + 16;
+  char expression[expressionSize];
+  // The 10x10 matrix with 2 on the diagonal and 1 elsewhere
+  constexpr int dimension = 10;
+  int length = strlcpy(matrix, "[", bufferSize);
+  for (int i = 0; i < dimension; i++) {
+    length += strlcpy(matrix + length, "[", bufferSize - length);
+    for (int j = 0; j < dimension; j++) {
+      length += strlcpy(matrix + length, i == j ? "2," : "1,", bufferSize - length);
+    }
+    matrix[length - 1] = ']';
+  }
+  length += strlcpy(matrix + length, "]", bufferSize - length);
+  quiz_assert(length < bufferSize);
+
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int n = 0; n < 10; n++) {
+    snprintf(expression, expressionSize, "det(%s)", matrix);
+    assert_expression_approximates_to<double>(expression, "11");
+    snprintf(expression, expressionSize, "trace(%s×%s)", matrix, matrix);
+    assert_expression_approximates_to<double>(expression, "130");
+    snprintf(expression, expressionSize, "trace(inverse(%s))", matrix);
+    assert_expression_approximates_to<double>(expression, "9.0909090909091");
+  }
+  quiz_print("  10x10 determinants, products and inverses:");
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(poincare_large_sums_benchmark) {
+  /* Reducing a sum or a product visits each term along with the next one:
+   * they should be walked in order, not fetched one by one by index. */
+  constexpr int expressionSize = 512;
+  char expression[expressionSize];
+  char result[expressionSize];
+
+  // 1+2+...+50
+  int length = strlcpy(expression, "1", expressionSize);
+  for (int i = 2; i <= 50; i++) {
+    length += snprintf(expression + length, expressionSize - length, "+%d", i);
+  }
+  quiz_assert(length < expressionSize);
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int n = 0; n < 10; n++) {
+    assert_expression_approximates_to<double>(expression, "1275");
+    assert_parsed_expression_simplify_to(expression, "1275");
+  }
+  quiz_print("  50-term sums of integers:");
+  quiz_stopwatch_print_lap(startTime);
+
+  /* x+x^2+...+x^50, which has no like terms, and x×x^2×...×x^50. The reduced
+   * sum lists the terms by decreasing degree. */
+  length = strlcpy(expression, "x", expressionSize);
+  int resultLength = 0;
+  for (int i = 2; i <= 50; i++) {
+    length += snprintf(expression + length, expressionSize - length, "+x^%d", i);
+    resultLength += snprintf(result + resultLength, expressionSize - resultLength, "x^%d+", 52 - i);
+  }
+  resultLength += strlcpy(result + resultLength, "x", expressionSize - resultLength);
+  quiz_assert(length < expressionSize && resultLength < expressionSize);
+  startTime = quiz_stopwatch_start();
+  for (int n = 0; n < 10; n++) {
+    assert_parsed_expression_simplify_to(expression, result);
+  }
+  quiz_print("  50-term polynomials:");
+  quiz_stopwatch_print_lap(startTime);
+
+  length = strlcpy(expression, "x", expressionSize);
+  for (int i = 2; i <= 50; i++) {
+    length += snprintf(expression + length, expressionSize - length, "×x^%d", i);
+  }
+  quiz_assert(length < expressionSize);
+  startTime = quiz_stopwatch_start();
+  for (int n = 0; n < 10; n++) {
+    assert_parsed_expression_simplify_to(expression, "x^1275");
+  }
+  quiz_print("  50-factor products:");
+  quiz_stopwatch_print_lap(startTime);
+}
@@ -3,6 +3,7 @@
 
 #include <ion/circuit_breaker.h>
 #include <poincare/checkpoint.h>
+#include <poincare/thread_local_state.h>
 
 /* Usage: See comment in checkpoint.h
  *
@@ -27,7 +28,7 @@ private:
   virtual bool isCurrentCircuitBreakerCheckpoint() const = 0;
   /* Keep current s_topmostExceptionCheckpoint to be able to restore it in a
    * valid state if CircuitBreakerCheckpoint is used. */
-  static Checkpoint * s_topmostExceptionCheckpoint;
+  static POINCARE_THREAD_LOCAL Checkpoint * s_topmostExceptionCheckpoint;
 };
 
 class UserCircuitBreakerCheckpoint final : public CircuitBreakerCheckpoint {
@@ -40,7 +41,7 @@ public:
 private:
   void setCurrentCircuitBreakerCheckpoint(CircuitBreakerCheckpoint * checkpoint) override { s_currentUserCircuitBreakerCheckpoint = checkpoint; }
   virtual bool isCurrentCircuitBreakerCheckpoint() const override { return s_currentUserCircuitBreakerCheckpoint == this; }
-  static CircuitBreakerCheckpoint * s_currentUserCircuitBreakerCheckpoint;
+  static POINCARE_THREAD_LOCAL CircuitBreakerCheckpoint * s_currentUserCircuitBreakerCheckpoint;
 };
 
 class SystemCircuitBreakerCheckpoint final : public CircuitBreakerCheckpoint {
@@ -58,7 +59,7 @@ public:
 private:
   void setCurrentCircuitBreakerCheckpoint(CircuitBreakerCheckpoint * checkpoint) override { s_currentSystemCircuitBreakerCheckpoint = checkpoint; }
   virtual bool isCurrentCircuitBreakerCheckpoint() const override { return s_currentSystemCircuitBreakerCheckpoint == this; }
-  static CircuitBreakerCheckpoint * s_currentSystemCircuitBreakerCheckpoint;
+  static POINCARE_THREAD_LOCAL CircuitBreakerCheckpoint * s_currentSystemCircuitBreakerCheckpoint;
 };
 
 }
@@ -34,7 +34,7 @@ public:
 private:
   void rollback() override;
 
-  static ExceptionCheckpoint * s_topmostExceptionCheckpoint;
+  static POINCARE_THREAD_LOCAL ExceptionCheckpoint * s_topmostExceptionCheckpoint;
 
   jmp_buf m_jumpBuffer;
   ExceptionCheckpoint * m_parent;
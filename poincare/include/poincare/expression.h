@@ -77,6 +77,7 @@ class Expression : public TreeHandle {
   friend class Multiplication;
   friend class MultiplicationNode;
   friend class NaperianLogarithm;
+  friend class NAryExpression;
   friend class NormalDistributionFunction;
   friend class NormCDF;
   friend class NormCDF2;
@@ -87,6 +88,7 @@ class Expression : public TreeHandle {
   friend class ParameteredExpression;
   friend class Parenthesis;
   friend class PermuteCoefficient;
+  friend class Polynomial;
   friend class Power;
   friend class PowerNode;
   friend class PredictionInterval;
@@ -6,6 +6,8 @@
 
 namespace Poincare {
 
+class Integer;
+
 class MatrixNode /*final*/ : public Array, public ExpressionNode {
 public:
   MatrixNode() : Array() {}
@@ -69,6 +71,14 @@ public:
   Expression createTrace();
   // Inverse the array in-place. Array has to be given in the form array[row_index][column_index]
   template<typename T> static int ArrayInverse(T * array, int numberOfRows, int numberOfColumns);
+  /* Decompose the square array in place into P*A = L*U with threshold partial
+   * pivoting: U is stored on and above the diagonal, and the unit lower triangular L
+   * below it. Row i of P*A is row permutation[i] of A. Returns the sign of the
+   * permutation P, or 0 if A is singular. */
+  template<typename T> static int ArrayLUDecomposition(T * array, int dim, int * permutation);
+  /* Solve L*U*x = b in place in b, with L and U given by ArrayLUDecomposition.
+   * b has to be permuted by P beforehand. */
+  template<typename T> static void ArrayLUSolve(const T * array, int dim, T * b);
   static Matrix CreateIdentity(int dim);
   Matrix createTranspose() const;
   Expression createRef(ExpressionNode::ReductionContext reductionContext, bool * couldComputeRef, bool reduced) const;
@@ -89,7 +99,20 @@ private:
   MatrixNode * node() const { return static_cast<MatrixNode *>(Expression::node()); }
   void setNumberOfRows(int rows) { node()->setNumberOfRows(rows); }
   void setNumberOfColumns(int columns) { node()->setNumberOfColumns(columns); }
+  // A pivot is swapped only if it is smaller than this ratio of the biggest one
+  static constexpr double k_pivotThreshold = 0.1;
   Expression computeInverseOrDeterminant(bool computeDeterminant, ExpressionNode::ReductionContext reductionContext, bool * couldCompute) const;
+  /* Compute the inverse or the determinant of a matrix of rationals without
+   * building expressions for the intermediate coefficients. Returns an
+   * uninitialized expression if a coefficient is not a rational or if an
+   * integer overflows. */
+  Expression rationalInverseOrDeterminant(bool computeDeterminant);
+  /* Fraction-free (Bareiss) elimination of the array of integers, whose first
+   * numberOfRows columns form a square matrix. Once the reduced form is
+   * computed, the diagonal is filled with the determinant of this square
+   * matrix, times the sign of the row swaps. Returns false if an integer
+   * overflows. */
+  static bool IntegerArrayRowCanonize(Integer * array, int numberOfRows, int numberOfColumns, Integer * determinant, bool reduced);
   // rowCanonize turns a matrix in its row echelon form, reduced or not.
   Matrix rowCanonize(ExpressionNode::ReductionContext reductionContext, Expression * determinant, bool reduced = true);
   // Row canonize the array in place
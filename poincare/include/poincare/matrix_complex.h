@@ -18,7 +18,13 @@ public:
     EvaluationNode<T>()
   {}
 
+  /* complexAtIndex walks all the coefficients before index: loops over the
+   * coefficients read them in order with ComplexOfCoefficient instead. */
   std::complex<T> complexAtIndex(int index) const;
+  static std::complex<T> ComplexOfCoefficient(const EvaluationNode<T> * coefficient);
+  /* Copy all the coefficients in a single walk. Linear algebra is computed in
+   * double precision whatever T. */
+  void copyComplexes(std::complex<double> * operands) const;
 
   // TreeNode
   size_t size() const override { return sizeof(MatrixComplexNode<T>); }
@@ -63,6 +69,7 @@ public:
   std::complex<T> complexAtIndex(int index) const {
     return node()->complexAtIndex(index);
   }
+  TreeNode::Direct<EvaluationNode<T>> coefficients() const { return node()->children(); }
   Array::VectorType vectorType() const { return node()->vectorType(); }
   int numberOfRows() const { return node()->numberOfRows(); }
   int numberOfColumns() const { return node()->numberOfColumns(); }
@@ -25,6 +25,17 @@ public:
   void sortChildrenInPlace(ExpressionOrder order, Context * context, bool canSwapMatrices);
   Expression squashUnaryHierarchyInPlace();
 
+private:
+  /* Sorting needs a few bytes of stack per child. Longer expressions are
+   * bubble sorted in place. */
+  constexpr static int k_maxNumberOfSortedChildren = 64;
+  struct SortedChild {
+    const ExpressionNode * node;
+    bool isMatrix;
+  };
+  static bool ComesAfter(const SortedChild & c1, const SortedChild & c2, ExpressionOrder order, bool canSwapMatrices);
+  void bubbleSortChildrenInPlace(ExpressionOrder order, Context * context, bool canSwapMatrices);
+
 protected:
   LayoutShape leftLayoutShape() const override { return childAtIndex(0)->leftLayoutShape(); };
   LayoutShape rightLayoutShape() const override { return childAtIndex(numberOfChildren()-1)->rightLayoutShape(); }
@@ -55,6 +66,13 @@ protected:
     node()->sortChildrenInPlace(order, context, canSwapMatrices);
   }
   NAryExpressionNode * node() const { return static_cast<NAryExpressionNode *>(Expression::node()); }
+  /* childAtIndex walks all the siblings before a child. Reductions which visit
+   * the children one after the other step to the next sibling instead. Unlike
+   * a node pointer, the handle of a child remains valid when the children
+   * after it are replaced or removed. child must not be the last child. */
+  static Expression NextSibling(Expression child) {
+    return Expression(static_cast<ExpressionNode *>(child.node()->nextSibling()));
+  }
   Expression checkChildrenAreRationalIntegersAndUpdate(ExpressionNode::ReductionContext reductionContext);
 };
 
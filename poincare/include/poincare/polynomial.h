@@ -3,6 +3,7 @@
 
 #include <poincare/expression.h>
 #include <poincare/rational.h>
+#include <complex>
 
 namespace Poincare {
 
@@ -12,6 +13,21 @@ public:
 
   static int CubicPolynomialRoots(Expression a, Expression b, Expression c, Expression d, Expression * root1, Expression * root2, Expression * root3, Expression * delta, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool * approximateSolutions = nullptr);
 
+  /* Polynomials of higher degree are solved numerically. Their coefficients
+   * are interpolated from the values of the expression on a circle, as the
+   * exact coefficients are only computed up to Expression::k_maxPolynomialDegree. */
+  static constexpr int k_maxApproximatedDegree = 20;
+  /* ApproximateRealRoots fills roots with the distinct real roots of
+   * polynomial, in increasing order, and returns their number. It returns -1
+   * if the polynomial cannot be approximated on the interpolation circle. */
+  static int ApproximateRealRoots(const Expression & polynomial, const char * symbol, int degree, double * roots, Context * context, Preferences::AngleUnit angleUnit);
+  /* ApproximateRoots computes the distinct complex roots of the polynomial of
+   * the given coefficients, by increasing degree, with the Aberth-Ehrlich
+   * iteration. errorBounds[i] is the radius of a disc around roots[i] which
+   * contains at least one root of the polynomial, up to rounding errors on its
+   * coefficients. The roots found in the same disc are merged. */
+  static int ApproximateRoots(const std::complex<double> * coefficients, int degree, std::complex<double> * roots, double * errorBounds);
+
 private:
   static constexpr int k_maxNumberOfNodesBeforeApproximatingDelta = 16;
   static Expression ReducePolynomial(const Expression * coefficients, int degree, Expression parameter, ExpressionNode::ReductionContext reductionContext);
@@ -20,6 +36,14 @@ private:
   static Expression RationalRootSearch(const Expression * coefficients, int degree, ExpressionNode::ReductionContext reductionContext);
   static Expression SumRootSearch(const Expression * coefficients, int degree, int relevantCoefficient, ExpressionNode::ReductionContext reductionContext);
   static Expression CardanoNumber(Expression delta0, Expression delta1, bool * approximate, ExpressionNode::ReductionContext reductionContext);
+
+  static constexpr int k_maxNumberOfAberthIterations = 100;
+  static constexpr int k_numberOfMultipleRootNewtonSteps = 3;
+  // Starting points of the iteration are rotated to avoid symmetric guesses
+  static constexpr double k_startingAngle = 0.4;
+  static bool InterpolateCoefficients(const Expression & polynomial, const char * symbol, int degree, double radius, std::complex<double> * coefficients, Context * context, Preferences::AngleUnit angleUnit);
+  static double RoundingErrorFactor(int degree);
+  static void EvaluateApproximatePolynomial(const std::complex<double> * coefficients, int degree, std::complex<double> z, std::complex<double> * value, std::complex<double> * derivative, double * roundingErrorBound);
 };
 
 }
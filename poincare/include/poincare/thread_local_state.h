@@ -0,0 +1,16 @@
+#ifndef POINCARE_THREAD_LOCAL_STATE_H
+#define POINCARE_THREAD_LOCAL_STATE_H
+
+/* The state of Poincare computations (the tree pool, the checkpoints and the
+ * working buffers) is made of statics. Where POINCARE_THREAD_LOCAL_STATE is
+ * set, each thread has its own: a thread can then compute expressions once it
+ * has registered its own pool with TreePool::RegisterPool. The preferences and
+ * the storage remain shared by all threads. */
+
+#if POINCARE_THREAD_LOCAL_STATE
+#define POINCARE_THREAD_LOCAL thread_local
+#else
+#define POINCARE_THREAD_LOCAL
+#endif
+
+#endif
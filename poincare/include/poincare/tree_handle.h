@@ -106,6 +106,9 @@ public:
   void mergeChildrenAtIndexInPlace(TreeHandle t, int i);
   // Swap
   void swapChildrenInPlace(int i, int j);
+  /* Move the child at index permutation[k] to index k, for every child. The
+   * permutation is modified. */
+  void permuteChildrenInPlace(uint16_t * permutation);
 
   /* Logging */
 #if POINCARE_TREE_LOG
@@ -3,6 +3,7 @@
 
 #include "tree_node.h"
 #include <poincare/ghost_node.h>
+#include <poincare/thread_local_state.h>
 #include <stddef.h>
 #include <string.h>
 #include <new>
@@ -22,7 +23,12 @@ public:
   static TreePool * sharedPool() { assert(SharedStaticPool != nullptr); return SharedStaticPool; }
   static void RegisterPool(TreePool * pool) {  assert(SharedStaticPool == nullptr); SharedStaticPool = pool; }
 
-  TreePool() : m_cursor(buffer()) {}
+  TreePool() :
+    m_cursor(buffer())
+#if POINCARE_TREE_POOL_STATS
+    , m_highWaterMark(0)
+#endif
+  {}
 
   // Node
   TreeNode * node(uint16_t identifier) const {
@@ -49,13 +55,18 @@ public:
   __attribute__((__used__)) void log() { treeLog(std::cout); }
 #endif
   int numberOfNodes() const;
+#if POINCARE_TREE_POOL_STATS
+  // Largest number of bytes used by the nodes since the last reset
+  int highWaterMark() const { return m_highWaterMark; }
+  void resetHighWaterMark() { m_highWaterMark = m_cursor - constBuffer(); }
+#endif
 
 private:
   constexpr static int BufferSize = 32768;
   constexpr static int MaxNumberOfNodes = BufferSize/sizeof(TreeNode);
   constexpr static int k_maxNodeOffset = BufferSize/ByteAlignment;
 
-  static TreePool * SharedStaticPool;
+  static POINCARE_THREAD_LOCAL TreePool * SharedStaticPool;
 
   // TreeNode
   void discardTreeNode(TreeNode * node);
@@ -139,6 +150,11 @@ private:
   const char * constBuffer() const { return reinterpret_cast<const char *>(m_alignedBuffer); }
   AlignedNodeBuffer m_alignedBuffer[BufferSize/ByteAlignment];
   char * m_cursor;
+#if POINCARE_TREE_POOL_STATS
+  // Reported by the test runner
+  uint16_t m_highWaterMark;
+  static_assert(BufferSize <= UINT16_MAX, "The high water mark of the pool cannot be written with the chosen data size (uint16_t)");
+#endif
   IdentifierStack m_identifiers;
   uint16_t m_nodeForIdentifierOffset[MaxNumberOfNodes];
   static_assert(k_maxNodeOffset < UINT16_MAX && sizeof(m_nodeForIdentifierOffset[0]) == sizeof(uint16_t),
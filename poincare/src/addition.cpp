@@ -166,13 +166,14 @@ Expression Addition::shallowReduce(ExpressionNode::ReductionContext reductionCon
    * the result is not homogeneous. */
   {
     Expression unit;
-    if (childAtIndex(0).removeUnit(&unit).isUndefined()) {
+    Expression childI = childAtIndex(0).removeUnit(&unit);
+    if (childI.isUndefined()) {
       return replaceWithUndefinedInPlace();
     }
     const bool hasUnit = !unit.isUninitialized();
     for (int i = 1; i < childrenCount; i++) {
       Expression otherUnit;
-      Expression childI = childAtIndex(i).removeUnit(&otherUnit);
+      childI = NextSibling(childI).removeUnit(&otherUnit);
       if (childI.isUndefined()
           || hasUnit == otherUnit.isUninitialized()
           || (hasUnit && !unit.isIdenticalTo(otherUnit)))
@@ -255,22 +256,25 @@ Expression Addition::shallowReduce(ExpressionNode::ReductionContext reductionCon
   /* Step 5: Factorize like terms. Thanks to the simplification order, those are
    * next to each other at this point. */
   int i = 0;
+  Expression e1 = childAtIndex(0);
   while (i < numberOfChildren()-1) {
-    Expression e1 = childAtIndex(i);
-    Expression e2 = childAtIndex(i+1);
+    Expression e2 = NextSibling(e1);
     if (e1.isNumber() && e2.isNumber()) {
       Number r1 = static_cast<Number&>(e1);
       Number r2 = static_cast<Number&>(e2);
       Number a = Number::Addition(r1, r2);
-      replaceChildAtIndexInPlace(i, a);
-      removeChildAtIndexInPlace(i+1);
+      replaceChildInPlace(e1, a);
+      removeChildInPlace(e2, e2.numberOfChildren());
+      e1 = a;
       continue;
     }
     if (TermsHaveIdenticalNonNumeralFactors(e1, e2, reductionContext.context())) {
       factorizeChildrenAtIndexesInPlace(i, i+1, reductionContext);
+      e1 = childAtIndex(i);
       continue;
     }
     i++;
+    e1 = e2;
   }
 
   /* Step 6: Let's remove any zero. It's important to do this after having
@@ -278,13 +282,15 @@ Expression Addition::shallowReduce(ExpressionNode::ReductionContext reductionCon
    * pi+(-1)*pi. We don't remove the last zero if it's the only child left
    * though. */
   i = 0;
+  Expression e = childAtIndex(0);
   while (i < numberOfChildren()) {
-    Expression e = childAtIndex(i);
+    Expression next = i < numberOfChildren() - 1 ? NextSibling(e) : Expression();
     if (e.type() == ExpressionNode::Type::Rational && static_cast<Rational&>(e).isZero() && numberOfChildren() > 1) {
-      removeChildAtIndexInPlace(i);
-      continue;
+      removeChildInPlace(e, e.numberOfChildren());
+    } else {
+      i++;
     }
-    i++;
+    e = next;
   }
 
   // Step 7: Let's remove the addition altogether if it has a single child
@@ -103,8 +103,10 @@ template<typename T> Evaluation<T> ApproximationHelper::Map(const ExpressionNode
     assert(input.type() == EvaluationNode<T>::Type::MatrixComplex);
     MatrixComplex<T> m = static_cast<MatrixComplex<T> &>(input);
     MatrixComplex<T> result = MatrixComplex<T>::Builder();
-    for (int i = 0; i < m.numberOfChildren(); i++) {
-      result.addChildAtIndexInPlace(compute(m.complexAtIndex(i), approximationContext.complexFormat(), approximationContext.angleUnit()), i, i);
+    int i = 0;
+    for (EvaluationNode<T> * c : m.coefficients()) {
+      result.addChildAtIndexInPlace(compute(MatrixComplexNode<T>::ComplexOfCoefficient(c), approximationContext.complexFormat(), approximationContext.angleUnit()), i, i);
+      i++;
     }
     result.setDimensions(m.numberOfRows(), m.numberOfColumns());
     return std::move(result);
@@ -140,8 +142,10 @@ template<typename T> Evaluation<T> ApproximationHelper::MapReduce(const Expressi
 
 template<typename T> MatrixComplex<T> ApproximationHelper::ElementWiseOnMatrixComplexAndComplex(const MatrixComplex<T> m, const std::complex<T> c, Poincare::Preferences::ComplexFormat complexFormat, ComplexAndComplexReduction<T> computeOnComplexes) {
   MatrixComplex<T> matrix = MatrixComplex<T>::Builder();
-  for (int i = 0; i < m.numberOfChildren(); i++) {
-    matrix.addChildAtIndexInPlace(computeOnComplexes(m.complexAtIndex(i), c, complexFormat), i, i);
+  int i = 0;
+  for (EvaluationNode<T> * coefficient : m.coefficients()) {
+    matrix.addChildAtIndexInPlace(computeOnComplexes(MatrixComplexNode<T>::ComplexOfCoefficient(coefficient), c, complexFormat), i, i);
+    i++;
   }
   matrix.setDimensions(m.numberOfRows(), m.numberOfColumns());
   return matrix;
@@ -152,8 +156,12 @@ template<typename T> MatrixComplex<T> ApproximationHelper::ElementWiseOnComplexM
     return MatrixComplex<T>::Undefined();
   }
   MatrixComplex<T> matrix = MatrixComplex<T>::Builder();
-  for (int i = 0; i < m.numberOfChildren(); i++) {
-    matrix.addChildAtIndexInPlace(computeOnComplexes(m.complexAtIndex(i), n.complexAtIndex(i), complexFormat), i, i);
+  int i = 0;
+  typename TreeNode::Direct<EvaluationNode<T>>::Iterator nIterator = n.coefficients().begin();
+  for (EvaluationNode<T> * c : m.coefficients()) {
+    matrix.addChildAtIndexInPlace(computeOnComplexes(MatrixComplexNode<T>::ComplexOfCoefficient(c), MatrixComplexNode<T>::ComplexOfCoefficient(*nIterator), complexFormat), i, i);
+    ++nIterator;
+    i++;
   }
   matrix.setDimensions(m.numberOfRows(), m.numberOfColumns());
   return matrix;
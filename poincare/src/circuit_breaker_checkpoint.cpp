@@ -5,9 +5,9 @@
 
 namespace Poincare {
 
-Checkpoint * CircuitBreakerCheckpoint::s_topmostExceptionCheckpoint;
-CircuitBreakerCheckpoint * UserCircuitBreakerCheckpoint::s_currentUserCircuitBreakerCheckpoint;
-CircuitBreakerCheckpoint * SystemCircuitBreakerCheckpoint::s_currentSystemCircuitBreakerCheckpoint;
+POINCARE_THREAD_LOCAL Checkpoint * CircuitBreakerCheckpoint::s_topmostExceptionCheckpoint;
+POINCARE_THREAD_LOCAL CircuitBreakerCheckpoint * UserCircuitBreakerCheckpoint::s_currentUserCircuitBreakerCheckpoint;
+POINCARE_THREAD_LOCAL CircuitBreakerCheckpoint * SystemCircuitBreakerCheckpoint::s_currentSystemCircuitBreakerCheckpoint;
 
 bool CircuitBreakerCheckpoint::setActive(Ion::CircuitBreaker::Status status) {
   switch (status) {
@@ -2,7 +2,7 @@
 
 namespace Poincare {
 
-ExceptionCheckpoint * ExceptionCheckpoint::s_topmostExceptionCheckpoint;
+POINCARE_THREAD_LOCAL ExceptionCheckpoint * ExceptionCheckpoint::s_topmostExceptionCheckpoint;
 
 ExceptionCheckpoint::ExceptionCheckpoint() :
   Checkpoint(),
@@ -6,6 +6,7 @@
 #include <poincare/opposite.h>
 #include <poincare/rational.h>
 #include <poincare/symbol.h>
+#include <poincare/thread_local_state.h>
 #include <poincare/undefined.h>
 #include <poincare/variable_context.h>
 #include <ion.h>
@@ -18,7 +19,7 @@
 
 namespace Poincare {
 
-static bool sApproximationEncounteredComplex = false;
+static POINCARE_THREAD_LOCAL bool sApproximationEncounteredComplex = false;
 
 /* Constructor & Destructor */
 
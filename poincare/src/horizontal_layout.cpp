@@ -209,7 +209,7 @@ int HorizontalLayoutNode::serializeChildrenBetweenIndexes(char * buffer, int buf
       return bufferSize - 1;
     }
     if (i != childrenCount - 1) {
-      nextChild = childAtIndex(i+1);
+      nextChild = static_cast<LayoutNode *>(currentChild->nextSibling());
       // Write the multiplication sign if needed
       LayoutNode::Type nextChildType = nextChild->type();
       if ((nextChildType == LayoutNode::Type::AbsoluteValueLayout
@@ -309,11 +309,12 @@ KDRect HorizontalLayoutNode::relativeSelectionRect(const Layout * selectionStart
   }
   KDCoordinate maxUnderBaseline = 0;
   KDCoordinate maxAboveBaseline = 0;
+  LayoutNode * childi = selectionStart->node();
   for (int i = firstSelectedNodeIndex; i <= secondSelectedNodeIndex; i++) {
-    Layout childi = thisLayout.childAtIndex(i);
-    KDSize childSize = childi.layoutSize();
-    maxUnderBaseline = std::max<KDCoordinate>(maxUnderBaseline, childSize.height() - childi.baseline());
-    maxAboveBaseline = std::max(maxAboveBaseline, childi.baseline());
+    KDSize childSize = childi->layoutSize();
+    maxUnderBaseline = std::max<KDCoordinate>(maxUnderBaseline, childSize.height() - childi->baseline());
+    maxAboveBaseline = std::max(maxAboveBaseline, childi->baseline());
+    childi = static_cast<LayoutNode *>(childi->nextSibling());
   }
   return KDRect(KDPoint(selectionXStart, const_cast<HorizontalLayoutNode *>(this)->baseline() - maxAboveBaseline), KDSize(drawWidth, maxUnderBaseline + maxAboveBaseline));
 }
@@ -3,6 +3,7 @@
 #include <poincare/ieee754.h>
 #include <poincare/layout_helper.h>
 #include <poincare/serialization_helper.h>
+#include <poincare/thread_local_state.h>
 #include <ion/unicode/utf8_decoder.h>
 #include <ion/unicode/utf8_helper.h>
 #include <poincare/addition.h>
@@ -29,11 +30,11 @@ namespace Poincare {
  * lead to a stack overflow, we keep a static working buffer. We actually need
  * two of them because division involves inner multiplications and additions
  * (which would override the division digits if there were using the same
- * buffer). */
+ * buffer). Each thread has its own buffers if Poincare state is thread-local. */
 // TODO: we might want to go back to allocating the native_uint_t arrays on the stack once we increase the stack size from 32k to?
 
-static native_uint_t s_workingBuffer[Integer::k_maxNumberOfDigits + 1];
-static native_uint_t s_workingBufferDivision[Integer::k_maxNumberOfDigits + 1];
+static POINCARE_THREAD_LOCAL native_uint_t s_workingBuffer[Integer::k_maxNumberOfDigits + 1];
+static POINCARE_THREAD_LOCAL native_uint_t s_workingBufferDivision[Integer::k_maxNumberOfDigits + 1];
 
 uint8_t log2(native_uint_t v) {
   constexpr int nativeUnsignedIntegerBitCount = 8*sizeof(native_uint_t);
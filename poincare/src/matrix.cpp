@@ -6,6 +6,7 @@
 #include <float.h>
 #include <poincare/absolute_value.h>
 #include <poincare/addition.h>
+#include <poincare/arithmetic.h>
 #include <poincare/division.h>
 #include <poincare/exception_checkpoint.h>
 #include <poincare/matrix_complex.h>
@@ -68,12 +69,15 @@ int MatrixNode::serialize(char * buffer, int bufferSize, Preferences::PrintFloat
   if (currentChar >= bufferSize-1) {
     return currentChar;
   }
+  // Walk the coefficients in order rather than fetching each one by index
+  ExpressionNode * child = nullptr;
   for (int i = 0; i < m_numberOfRows; i++) {
     currentChar += SerializationHelper::CodePoint(buffer + currentChar, bufferSize - currentChar, '[');
     if (currentChar >= bufferSize-1) {
       return currentChar;
     }
-    currentChar += childAtIndex(i*m_numberOfColumns)->serialize(buffer+currentChar, bufferSize-currentChar, floatDisplayMode, numberOfSignificantDigits);
+    child = i == 0 ? childAtIndex(0) : static_cast<ExpressionNode *>(child->nextSibling());
+    currentChar += child->serialize(buffer+currentChar, bufferSize-currentChar, floatDisplayMode, numberOfSignificantDigits);
     if (currentChar >= bufferSize-1) {
       return currentChar;
     }
@@ -82,7 +86,8 @@ int MatrixNode::serialize(char * buffer, int bufferSize, Preferences::PrintFloat
       if (currentChar >= bufferSize-1) {
         return currentChar;
       }
-      currentChar += childAtIndex(i*m_numberOfColumns+j)->serialize(buffer+currentChar, bufferSize-currentChar, floatDisplayMode, numberOfSignificantDigits);
+      child = static_cast<ExpressionNode *>(child->nextSibling());
+      currentChar += child->serialize(buffer+currentChar, bufferSize-currentChar, floatDisplayMode, numberOfSignificantDigits);
       if (currentChar >= bufferSize-1) {
         return currentChar;
       }
@@ -169,37 +174,104 @@ int Matrix::ArrayInverse(T * array, int numberOfRows, int numberOfColumns) {
   }
   assert(numberOfRows*numberOfColumns <= k_maxNumberOfCoefficients);
   int dim = numberOfRows;
-  /* Create the matrix inv = (A|I) with A the input matrix and I the dim identity matrix
-   * (A is squared with less than k_maxNumberOfCoefficients so (A|I) has less than
-   * 2*k_maxNumberOfCoefficients */
-  T operands[2*k_maxNumberOfCoefficients];
-  for (int i = 0; i < dim; i++) {
-    for (int j = 0; j < dim; j++) {
-      T cell = array[i*numberOfColumns+j];
-      // Using abs function to be compatible with both double and std::complex
-      if (!std::isfinite(std::abs(cell))) {
+  /* Solve A*X = I column by column with the LU decomposition of A, which takes
+   * a third of the operations of the Gauss-Jordan elimination of (A|I). */
+  T lu[k_maxNumberOfCoefficients];
+  for (int i = 0; i < dim*dim; i++) {
+    // Using abs function to be compatible with both double and std::complex
+    if (!std::isfinite(std::abs(array[i]))) {
+      return -2;
+    }
+    lu[i] = array[i];
+  }
+  int permutation[k_maxNumberOfCoefficients];
+  if (ArrayLUDecomposition(lu, dim, permutation) == 0) {
+    return -2;
+  }
+  T column[k_maxNumberOfCoefficients];
+  for (int j = 0; j < dim; j++) {
+    // Column j of P*I
+    for (int i = 0; i < dim; i++) {
+      column[i] = permutation[i] == j ? 1.0 : 0.0;
+    }
+    ArrayLUSolve(lu, dim, column);
+    for (int i = 0; i < dim; i++) {
+      if (!std::isfinite(std::abs(column[i]))) {
         return -2;
       }
-      operands[i*2*dim+j] = cell;
-    }
-    for (int j = dim; j < 2*dim; j++) {
-      operands[i*2*dim+j] = j-dim == i ? 1.0 : 0.0;
+      array[i*numberOfColumns+j] = column[i];
     }
   }
-  ArrayRowCanonize(operands, dim, 2*dim);
-  // Check inversibility
+  return 0;
+}
+
+template<typename T>
+int Matrix::ArrayLUDecomposition(T * array, int dim, int * permutation) {
+  int sign = 1;
   for (int i = 0; i < dim; i++) {
-    T cell = operands[i*2*dim+i];
-    if (!std::isfinite(std::abs(cell)) || std::abs(cell - (T)1.0) > Expression::Epsilon<float>()) {
-      return -2;
+    permutation[i] = i;
+  }
+  for (int k = 0; k < dim; k++) {
+    /* Find the biggest pivot (in absolute value) to limit rounding errors.
+     * The pivot in place is kept if it is not much smaller: this threshold
+     * still bounds the growth of the coefficients, and avoids swapping rows
+     * of matrices which are exactly decomposed as they are, such as most
+     * integer matrices. */
+    int iPivot = k;
+    // Using double to stay accurate with any type T
+    double bestPivot = 0.0;
+    for (int i = k; i < dim; i++) {
+      double pivot = std::abs(array[i*dim+k]);
+      if (pivot > bestPivot) {
+        bestPivot = pivot;
+        iPivot = i;
+      }
+    }
+    if (bestPivot < DBL_MIN) {
+      // No non-null coefficient in this column
+      return 0;
+    }
+    if (std::abs(array[k*dim+k]) >= k_pivotThreshold*bestPivot) {
+      iPivot = k;
+    }
+    if (iPivot != k) {
+      for (int j = 0; j < dim; j++) {
+        T temp = array[iPivot*dim+j];
+        array[iPivot*dim+j] = array[k*dim+j];
+        array[k*dim+j] = temp;
+      }
+      int temp = permutation[iPivot];
+      permutation[iPivot] = permutation[k];
+      permutation[k] = temp;
+      sign = -sign;
+    }
+    T pivot = array[k*dim+k];
+    for (int i = k+1; i < dim; i++) {
+      T factor = array[i*dim+k] / pivot;
+      array[i*dim+k] = factor;
+      for (int j = k+1; j < dim; j++) {
+        array[i*dim+j] -= factor*array[k*dim+j];
+      }
     }
   }
-  for (int i = 0; i < dim; i++) {
-    for (int j = 0; j < dim; j++) {
-      array[i*numberOfColumns+j] = operands[i*2*dim+j+dim];
+  return sign;
+}
+
+template<typename T>
+void Matrix::ArrayLUSolve(const T * array, int dim, T * b) {
+  // Forward substitution: L has ones on its diagonal
+  for (int i = 1; i < dim; i++) {
+    for (int j = 0; j < i; j++) {
+      b[i] -= array[i*dim+j]*b[j];
     }
   }
-  return 0;
+  // Back substitution
+  for (int i = dim-1; i >= 0; i--) {
+    for (int j = i+1; j < dim; j++) {
+      b[i] -= array[i*dim+j]*b[j];
+    }
+    b[i] /= array[i*dim+i];
+  }
 }
 
 Matrix Matrix::rowCanonize(ExpressionNode::ReductionContext reductionContext, Expression * determinant, bool reduced) {
@@ -578,6 +650,10 @@ Expression Matrix::computeInverseOrDeterminant(bool computeDeterminant, Expressi
      * after the long jump. */
     Matrix cl = clone().convert<Matrix>();
     *couldCompute = true;
+    Expression rationalResult = cl.rationalInverseOrDeterminant(computeDeterminant);
+    if (!rationalResult.isUninitialized()) {
+      return rationalResult;
+    }
     /* Create the matrix (A|I) with A is the input matrix and I the dim
      * identity matrix */
     Matrix matrixAI = Matrix::Builder();
@@ -619,10 +695,139 @@ Expression Matrix::computeInverseOrDeterminant(bool computeDeterminant, Expressi
   }
 }
 
+Expression Matrix::rationalInverseOrDeterminant(bool computeDeterminant) {
+  int dim = numberOfRows();
+  /* Compute the determinant of A, or the elimination of (A|I) for the inverse,
+   * with A the matrix scaled to integers. */
+  int numberOfColumns = computeDeterminant ? dim : 2*dim;
+  if (dim*numberOfColumns > 2*k_maxNumberOfCoefficients) {
+    return Expression();
+  }
+  Integer array[2*k_maxNumberOfCoefficients];
+  Integer scalesProduct(1);
+  for (int i = 0; i < dim; i++) {
+    // Scale the row i by the LCM of its denominators
+    Integer scale(1);
+    for (int j = 0; j < dim; j++) {
+      Expression coefficient = matrixChild(i, j);
+      if (coefficient.type() != ExpressionNode::Type::Rational) {
+        return Expression();
+      }
+      scale = Arithmetic::LCM(scale, static_cast<Rational &>(coefficient).integerDenominator());
+    }
+    if (scale.isOverflow()) {
+      return Expression();
+    }
+    for (int j = 0; j < dim; j++) {
+      Rational coefficient = matrixChild(i, j).convert<Rational>();
+      array[i*numberOfColumns+j] = Integer::Multiplication(coefficient.signedIntegerNumerator(), Integer::Division(scale, coefficient.integerDenominator()).quotient);
+      if (array[i*numberOfColumns+j].isOverflow()) {
+        return Expression();
+      }
+    }
+    if (computeDeterminant) {
+      // det(S*A) = det(S)*det(A) with S the diagonal matrix of the scales
+      scalesProduct = Integer::Multiplication(scalesProduct, scale);
+      if (scalesProduct.isOverflow()) {
+        return Expression();
+      }
+    } else {
+      // Solving (S*A)*X = S gives X = A^-1
+      for (int j = dim; j < 2*dim; j++) {
+        array[i*numberOfColumns+j] = j-dim == i ? scale : Integer(0);
+      }
+    }
+  }
+  Integer determinant;
+  if (!IntegerArrayRowCanonize(array, dim, numberOfColumns, &determinant, !computeDeterminant)) {
+    return Expression();
+  }
+  if (computeDeterminant) {
+    return Rational::Builder(determinant, scalesProduct);
+  }
+  if (determinant.isZero()) {
+    return Undefined::Builder();
+  }
+  Matrix inverse = Matrix::Builder();
+  for (int i = 0; i < dim; i++) {
+    for (int j = 0; j < dim; j++) {
+      // Rational::Builder simplifies its arguments in place
+      Integer denominator = array[i*numberOfColumns+i];
+      inverse.addChildAtIndexInPlace(Rational::Builder(array[i*numberOfColumns+dim+j], denominator), i*dim+j, i*dim+j);
+    }
+  }
+  inverse.setDimensions(dim, dim);
+  return std::move(inverse);
+}
+
+static bool BareissStep(Integer * coefficient, const Integer & pivot, const Integer & factor, const Integer & pivotRowCoefficient, const Integer & previousPivot) {
+  Integer product = Integer::Subtraction(Integer::Multiplication(pivot, *coefficient), Integer::Multiplication(factor, pivotRowCoefficient));
+  if (product.isOverflow()) {
+    return false;
+  }
+  if (previousPivot.isOne()) {
+    *coefficient = product;
+  } else {
+    IntegerDivision division = Integer::Division(product, previousPivot);
+    assert(division.remainder.isZero());
+    *coefficient = division.quotient;
+  }
+  return true;
+}
+
+bool Matrix::IntegerArrayRowCanonize(Integer * array, int numberOfRows, int numberOfColumns, Integer * determinant, bool reduced) {
+  /* Each step replaces M[i][j] with (M[k][k]*M[i][j]-M[i][k]*M[k][j])/p, where
+   * p is the previous pivot. The division is exact, and the coefficients are
+   * minors of the matrix: they do not grow exponentially. */
+  Integer previousPivot(1);
+  bool negative = false;
+  for (int k = 0; k < numberOfRows; k++) {
+    // Integers are exact: any non-null pivot is fine
+    int iPivot = k;
+    while (iPivot < numberOfRows && array[iPivot*numberOfColumns+k].isZero()) {
+      iPivot++;
+    }
+    if (iPivot == numberOfRows) {
+      // No non-null coefficient in this column: the matrix is singular
+      *determinant = Integer(0);
+      return true;
+    }
+    if (iPivot != k) {
+      for (int col = 0; col < numberOfColumns; col++) {
+        Integer temp = array[iPivot*numberOfColumns+col];
+        array[iPivot*numberOfColumns+col] = array[k*numberOfColumns+col];
+        array[k*numberOfColumns+col] = temp;
+      }
+      negative = !negative;
+    }
+    Integer pivot = array[k*numberOfColumns+k];
+    /* In reduced form, the rows above the pivot are eliminated too. Their
+     * coefficients left of the pivot column are null, except on the diagonal. */
+    for (int i = reduced ? 0 : k+1; i < numberOfRows; i++) {
+      if (i == k) { continue; }
+      Integer factor = array[i*numberOfColumns+k];
+      for (int j = k+1; j < numberOfColumns; j++) {
+        if (!BareissStep(array + i*numberOfColumns+j, pivot, factor, array[k*numberOfColumns+j], previousPivot)) {
+          return false;
+        }
+      }
+      // M[k][i] is null for the rows above, which only updates their diagonal
+      if (i < k && !BareissStep(array + i*numberOfColumns+i, pivot, Integer(0), Integer(0), previousPivot)) {
+        return false;
+      }
+      array[i*numberOfColumns+k] = Integer(0);
+    }
+    previousPivot = pivot;
+  }
+  previousPivot.setNegative(negative != previousPivot.isNegative());
+  *determinant = previousPivot;
+  return true;
+}
 
 template int Matrix::ArrayInverse<double>(double *, int, int);
 template int Matrix::ArrayInverse<std::complex<float>>(std::complex<float> *, int, int);
 template int Matrix::ArrayInverse<std::complex<double>>(std::complex<double> *, int, int);
+template int Matrix::ArrayLUDecomposition<std::complex<double>>(std::complex<double> *, int, int *);
 template void Matrix::ArrayRowCanonize<std::complex<float> >(std::complex<float>*, int, int, std::complex<float>*, bool);
 template void Matrix::ArrayRowCanonize<std::complex<double> >(std::complex<double>*, int, int, std::complex<double>*, bool);
 
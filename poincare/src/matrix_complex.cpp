@@ -18,13 +18,34 @@ void MatrixComplexNode<T>::didAddChildAtIndex(int newNumberOfChildren) {
 
 template<typename T>
 std::complex<T> MatrixComplexNode<T>::complexAtIndex(int index) const {
-  EvaluationNode<T> * child = EvaluationNode<T>::childAtIndex(index);
-  if (child->type() == EvaluationNode<T>::Type::Complex) {
-    return *(static_cast<ComplexNode<T> *>(child));
+  return ComplexOfCoefficient(EvaluationNode<T>::childAtIndex(index));
+}
+
+template<typename T>
+std::complex<T> MatrixComplexNode<T>::ComplexOfCoefficient(const EvaluationNode<T> * coefficient) {
+  if (coefficient->type() == EvaluationNode<T>::Type::Complex) {
+    return *(static_cast<const ComplexNode<T> *>(coefficient));
   }
   return std::complex<T>(NAN, NAN);
 }
 
+template<typename T>
+void MatrixComplexNode<T>::copyComplexes(std::complex<double> * operands) const {
+  int i = 0;
+  for (EvaluationNode<T> * c : this->children()) {
+    operands[i++] = ComplexOfCoefficient(c); // Returns complex<T>(NAN, NAN) if Node type is not Complex
+  }
+}
+
+template<typename T>
+static MatrixComplex<T> MatrixComplexFromOperands(const std::complex<double> * operands, int numberOfRows, int numberOfColumns) {
+  std::complex<T> operandsCopy[Matrix::k_maxNumberOfCoefficients];
+  for (int i = 0; i < numberOfRows*numberOfColumns; i++) {
+    operandsCopy[i] = std::complex<T>(operands[i]);
+  }
+  return MatrixComplex<T>::Builder(operandsCopy, numberOfRows, numberOfColumns);
+}
+
 template<typename T>
 bool MatrixComplexNode<T>::isUndefined() const {
   if (numberOfRows() != 1 || numberOfColumns() != 1) {
@@ -63,8 +84,13 @@ std::complex<T> MatrixComplexNode<T>::trace() const {
   }
   int dim = numberOfRows();
   std::complex<T> c = std::complex<T>(0);
-  for (int i = 0; i < dim; i++) {
-    c += complexAtIndex(i*dim+i);
+  int i = 0;
+  for (EvaluationNode<T> * coefficient : this->children()) {
+    // Diagonal coefficients are dim+1 coefficients apart
+    if (i++ % (dim + 1) != 0) {
+      continue;
+    }
+    c += ComplexOfCoefficient(coefficient);
     if (std::isnan(c.real()) || std::isnan(c.imag())) {
       return std::complex<T>(NAN, NAN);
     }
@@ -77,13 +103,20 @@ std::complex<T> MatrixComplexNode<T>::determinant() const {
   if (numberOfRows() != numberOfColumns() || numberOfChildren() == 0 || numberOfChildren() > Matrix::k_maxNumberOfCoefficients) {
     return std::complex<T>(NAN, NAN);
   }
-  std::complex<T> operandsCopy[Matrix::k_maxNumberOfCoefficients];
+  std::complex<double> operandsCopy[Matrix::k_maxNumberOfCoefficients];
+  copyComplexes(operandsCopy);
   for (int i = 0; i < numberOfChildren(); i++) {
-    operandsCopy[i] = complexAtIndex(i); // Returns complex<T>(NAN, NAN) if Node type is not Complex
+    if (std::isnan(operandsCopy[i].real()) || std::isnan(operandsCopy[i].imag())) {
+      return std::complex<T>(NAN, NAN);
+    }
+  }
+  // The determinant is the signed product of the pivots of the decomposition
+  int permutation[Matrix::k_maxNumberOfCoefficients];
+  std::complex<double> determinant = Matrix::ArrayLUDecomposition(operandsCopy, m_numberOfRows, permutation);
+  for (int i = 0; i < m_numberOfRows; i++) {
+    determinant *= operandsCopy[i*m_numberOfRows+i];
   }
-  std::complex<T> determinant = std::complex<T>(1);
-  Matrix::ArrayRowCanonize(operandsCopy, m_numberOfRows, m_numberOfColumns, &determinant);
-  return determinant;
+  return std::complex<T>(determinant);
 }
 
 template<typename T>
@@ -91,20 +124,20 @@ MatrixComplex<T> MatrixComplexNode<T>::inverse() const {
   if (numberOfRows() != numberOfColumns() || numberOfChildren() == 0 || numberOfChildren() > Matrix::k_maxNumberOfCoefficients) {
     return MatrixComplex<T>::Undefined();
   }
-  std::complex<T> operandsCopy[Matrix::k_maxNumberOfCoefficients];
+  std::complex<double> operandsCopy[Matrix::k_maxNumberOfCoefficients];
   int i = 0;
   for (EvaluationNode<T> * c : this->children()) {
     if (c->type() != EvaluationNode<T>::Type::Complex) {
       return MatrixComplex<T>::Undefined();
     }
-    operandsCopy[i] = complexAtIndex(i);
+    operandsCopy[i] = ComplexOfCoefficient(c);
     i++;
   }
   int result = Matrix::ArrayInverse(operandsCopy, m_numberOfRows, m_numberOfColumns);
   if (result == 0) {
     /* Intentionally swapping dimensions for inverse, although it doesn't make a
      * difference because it is square. */
-    return MatrixComplex<T>::Builder(operandsCopy, m_numberOfColumns, m_numberOfRows);
+    return MatrixComplexFromOperands<T>(operandsCopy, m_numberOfColumns, m_numberOfRows);
   }
   return MatrixComplex<T>::Undefined();
 }
@@ -128,14 +161,12 @@ MatrixComplex<T> MatrixComplexNode<T>::ref(bool reduced) const {
   if (numberOfChildren() == 0 || numberOfChildren() > Matrix::k_maxNumberOfCoefficients) {
     return MatrixComplex<T>::Undefined();
   }
-  std::complex<T> operandsCopy[Matrix::k_maxNumberOfCoefficients];
-  for (int i = 0; i < numberOfChildren(); i++) {
-    operandsCopy[i] = complexAtIndex(i); // Returns complex<T>(NAN, NAN) if Node type is not Complex
-  }
+  std::complex<double> operandsCopy[Matrix::k_maxNumberOfCoefficients];
+  copyComplexes(operandsCopy);
   /* Reduced row echelon form is also called row canonical form. To compute the
    * row echelon form (non reduced one), fewer steps are required. */
-  Matrix::ArrayRowCanonize(operandsCopy, m_numberOfRows, m_numberOfColumns, static_cast<std::complex<T>*>(nullptr), reduced);
-  return MatrixComplex<T>::Builder(operandsCopy, m_numberOfRows, m_numberOfColumns);
+  Matrix::ArrayRowCanonize(operandsCopy, m_numberOfRows, m_numberOfColumns, static_cast<std::complex<double>*>(nullptr), reduced);
+  return MatrixComplexFromOperands<T>(operandsCopy, m_numberOfRows, m_numberOfColumns);
 }
 
 template<typename T>
@@ -144,8 +175,8 @@ std::complex<T> MatrixComplexNode<T>::norm() const {
     return std::complex<T>(NAN, NAN);
   }
   std::complex<T> sum = 0;
-  for (int i = 0; i < numberOfChildren(); i++) {
-    sum += std::norm(complexAtIndex(i));
+  for (EvaluationNode<T> * c : this->children()) {
+    sum += std::norm(ComplexOfCoefficient(c));
   }
   return std::sqrt(sum);
 }
@@ -160,8 +191,10 @@ std::complex<T> MatrixComplexNode<T>::dot(Evaluation<T> * e) const {
     return std::complex<T>(NAN, NAN);
   }
   std::complex<T> sum = 0;
-  for (int i = 0; i < numberOfChildren(); i++) {
-    sum += complexAtIndex(i) * b->complexAtIndex(i);
+  EvaluationNode<T> * bCoefficient = static_cast<EvaluationNode<T> *>(b->node()->next());
+  for (EvaluationNode<T> * c : this->children()) {
+    sum += ComplexOfCoefficient(c) * ComplexOfCoefficient(bCoefficient);
+    bCoefficient = static_cast<EvaluationNode<T> *>(bCoefficient->nextSibling());
   }
   return sum;
 }
@@ -76,16 +76,33 @@ MatrixComplex<T> MultiplicationNode::computeOnMatrices(const MatrixComplex<T> m,
     return MatrixComplex<T>::Undefined();
   }
   MatrixComplex<T> result = MatrixComplex<T>::Builder();
+  int numberOfCoefficients = m.numberOfRows()*n.numberOfColumns();
+  for (int i = 0; i < numberOfCoefficients; i++) {
+    result.addChildAtIndexInPlace(Complex<T>::Builder(0.0), i, i);
+  }
+  result.setDimensions(m.numberOfRows(), n.numberOfColumns());
+  /* Fetching the coefficients by index walks the siblings before them. Instead,
+   * the row i of the result accumulates m(i,k) times the row k of n, so that
+   * the coefficients of m, n and the result are all read in order. */
+  typedef typename TreeNode::Direct<EvaluationNode<T>>::Iterator CoefficientIterator;
+  CoefficientIterator mIterator = m.coefficients().begin();
+  CoefficientIterator resultRow = result.coefficients().begin();
   for (int i = 0; i < m.numberOfRows(); i++) {
-    for (int j = 0; j < n.numberOfColumns(); j++) {
-      std::complex<T> c(0.0);
-      for (int k = 0; k < m.numberOfColumns(); k++) {
-        c += m.complexAtIndex(i*m.numberOfColumns()+k)*n.complexAtIndex(k*n.numberOfColumns()+j);
+    CoefficientIterator nIterator = n.coefficients().begin();
+    CoefficientIterator resultIterator = resultRow;
+    for (int k = 0; k < m.numberOfColumns(); k++) {
+      std::complex<T> mik = MatrixComplexNode<T>::ComplexOfCoefficient(*mIterator);
+      ++mIterator;
+      resultIterator = resultRow;
+      for (int j = 0; j < n.numberOfColumns(); j++) {
+        ComplexNode<T> * c = static_cast<ComplexNode<T> *>(*resultIterator);
+        *c += mik*MatrixComplexNode<T>::ComplexOfCoefficient(*nIterator);
+        ++resultIterator;
+        ++nIterator;
       }
-      result.addChildAtIndexInPlace(Complex<T>::Builder(c), i*n.numberOfColumns()+j, result.numberOfChildren());
     }
+    resultRow = resultIterator;
   }
-  result.setDimensions(m.numberOfRows(), n.numberOfColumns());
   return result;
 }
 
@@ -711,9 +728,9 @@ Expression Multiplication::privateShallowReduce(ExpressionNode::ReductionContext
    * the simplification order, such terms are guaranteed to be next to each
    * other. */
   int i = 0;
+  Expression oi = childAtIndex(0);
   while (i < numberOfChildren()-1) {
-    Expression oi = childAtIndex(i);
-    Expression oi1 = childAtIndex(i+1);
+    Expression oi1 = NextSibling(oi);
     if (oi.recursivelyMatches(Expression::IsRandom, context)) {
       // Do not factorize random or randint
     } else if (TermsHaveIdenticalBase(oi, oi1)) {
@@ -737,24 +754,28 @@ Expression Multiplication::privateShallowReduce(ExpressionNode::ReductionContext
 
       if (shouldFactorizeBase) {
         factorizeBase(i, i+1, reductionContext);
+        oi = childAtIndex(i);
         /* An undef term could have appeared when factorizing 1^inf and 1^-inf
          * for instance. In that case, we escape and return undef. */
-        if (childAtIndex(i).isUndefined()) {
+        if (oi.isUndefined()) {
           return replaceWithUndefinedInPlace();
         }
         continue;
       }
     } else if (TermHasNumeralBase(oi) && TermHasNumeralBase(oi1) && TermsHaveIdenticalExponent(oi, oi1)) {
       factorizeExponent(i, i+1, reductionContext);
+      oi = childAtIndex(i);
       continue;
     } else if (TermIsPowerOfRationals(oi) && TermIsPowerOfRationals(oi1)
             && !(oi.childAtIndex(1).convert<Rational>().isInteger() || oi1.childAtIndex(1).convert<Rational>().isInteger()))
     {
       if (gatherRationalPowers(i, i+1, reductionContext)) {
+        oi = childAtIndex(i);
         continue;
       }
     }
     i++;
+    oi = oi1;
   }
 
   /* Step 5: We look for terms of form sin(x)^p*cos(x)^q with p, q rational of
@@ -762,16 +783,21 @@ Expression Multiplication::privateShallowReduce(ExpressionNode::ReductionContext
    * - tan(x)^p*cos(x)^(p+q) if |p|<|q|
    * - tan(x)^(-q)*sin(x)^(p+q) otherwise */
   if (reductionContext.target() == ExpressionNode::ReductionTarget::User) {
+    Expression o1 = childAtIndex(0);
     for (int i = 0; i < numberOfChildren(); i++) {
-      Expression o1 = childAtIndex(i);
+      if (i > 0) {
+        o1 = NextSibling(o1);
+      }
       if (Base(o1).type() == ExpressionNode::Type::Sine && TermHasNumeralExponent(o1)) {
         const Expression x = Base(o1).childAtIndex(0);
         /* Thanks to the SimplificationOrder, Cosine-base factors are after
          * Sine-base factors */
+        Expression o2 = o1;
         for (int j = i+1; j < numberOfChildren(); j++) {
-          Expression o2 = childAtIndex(j);
+          o2 = NextSibling(o2);
           if (Base(o2).type() == ExpressionNode::Type::Cosine && TermHasNumeralExponent(o2) && Base(o2).childAtIndex(0).isIdenticalTo(x)) {
             factorizeSineAndCosine(i, j, reductionContext);
+            o1 = childAtIndex(i);
             break;
           }
         }
@@ -792,10 +818,12 @@ Expression Multiplication::privateShallowReduce(ExpressionNode::ReductionContext
    * sin(x)*cos(x) -> 1*tan(x)
    */
   i = 1;
+  Expression o = numberOfChildren() > 1 ? childAtIndex(1) : Expression();
   while (i < numberOfChildren()) {
-    Expression o = childAtIndex(i);
+    Expression next = i < numberOfChildren() - 1 ? NextSibling(o) : Expression();
     if (o.type() == ExpressionNode::Type::Rational && static_cast<Rational &>(o).isOne()) {
-      removeChildAtIndexInPlace(i);
+      removeChildInPlace(o, o.numberOfChildren());
+      o = next;
       continue;
     }
     if (o.isNumber()) {
@@ -813,16 +841,19 @@ Expression Multiplication::privateShallowReduce(ExpressionNode::ReductionContext
         if (m.isUndefined()) {
           return replaceWithUndefinedInPlace();
         }
-        replaceChildAtIndexInPlace(0, m);
-        removeChildAtIndexInPlace(i);
+        replaceChildInPlace(o0, m);
+        removeChildInPlace(o, o.numberOfChildren());
+        o = next;
       } else {
         // Number child has to be first
-        removeChildAtIndexInPlace(i);
+        removeChildInPlace(o, o.numberOfChildren());
         addChildAtIndexInPlace(o, 0, numberOfChildren());
+        o = childAtIndex(i);
       }
       continue;
     }
     i++;
+    o = next;
   }
 
    /* Step 7: If the first child is zero, the multiplication result is zero. We
@@ -860,10 +891,12 @@ Expression Multiplication::privateShallowReduce(ExpressionNode::ReductionContext
       && (p.isUninitialized() || p.type() != ExpressionNode::Type::Multiplication)
       && !hasRandom)
   {
-    for (int i = 0; i < numberOfChildren(); i++) {
-      if (childAtIndex(i).type() == ExpressionNode::Type::Addition) {
+    int i = 0;
+    for (TreeNode * c : node()->directChildren()) {
+      if (static_cast<ExpressionNode *>(c)->type() == ExpressionNode::Type::Addition) {
         return distributeOnOperandAtIndex(i, reductionContext);
       }
+      i++;
     }
   }
 
@@ -4,26 +4,80 @@ extern "C" {
 #include <assert.h>
 #include <stdlib.h>
 }
+#include <algorithm>
 #include <utility>
 
 namespace Poincare {
 
 void NAryExpressionNode::sortChildrenInPlace(ExpressionOrder order, Context * context, bool canSwapMatrices) {
+  Expression reference(this);
+  const int childrenCount = reference.numberOfChildren();
+  if (childrenCount > k_maxNumberOfSortedChildren) {
+    bubbleSortChildrenInPlace(order, context, canSwapMatrices);
+    return;
+  }
+  /* deepIsMatrix walks a child and looks its symbols up in the context, and
+   * childAtIndex walks the siblings: both are done once per child. The
+   * children are then sorted by index, and moved in the pool at the end. */
+  SortedChild sortedChildren[k_maxNumberOfSortedChildren];
+  uint16_t permutation[k_maxNumberOfSortedChildren];
+  int i = 0;
+  for (ExpressionNode * child : children()) {
+    sortedChildren[i].node = child;
+    sortedChildren[i].isMatrix = Expression(child).deepIsMatrix(context);
+    permutation[i] = i;
+    i++;
+  }
+
+  // Bottom-up merge sort, which is stable as the bubble sort was
+  uint16_t buffer[k_maxNumberOfSortedChildren];
+  uint16_t * source = permutation;
+  uint16_t * destination = buffer;
+  for (int width = 1; width < childrenCount; width *= 2) {
+    for (int start = 0; start < childrenCount; start += 2 * width) {
+      int middle = std::min(start + width, childrenCount);
+      int end = std::min(start + 2 * width, childrenCount);
+      int left = start;
+      int right = middle;
+      for (int k = start; k < end; k++) {
+        if (left < middle && (right >= end || !ComesAfter(sortedChildren[source[left]], sortedChildren[source[right]], order, canSwapMatrices))) {
+          destination[k] = source[left++];
+        } else {
+          destination[k] = source[right++];
+        }
+      }
+    }
+    std::swap(source, destination);
+  }
+  for (int k = 0; k < childrenCount; k++) {
+    if (source[k] != k) {
+      reference.permuteChildrenInPlace(source);
+      return;
+    }
+  }
+}
+
+bool NAryExpressionNode::ComesAfter(const SortedChild & c1, const SortedChild & c2, ExpressionOrder order, bool canSwapMatrices) {
+  /* Warning: Matrix operations are not always commutative (ie,
+   * multiplication) so we never swap 2 matrices. */
+  if (c1.isMatrix != c2.isMatrix) {
+    // we always put matrices at the end of expressions
+    return c1.isMatrix;
+  }
+  return (!c1.isMatrix || canSwapMatrices) && order(c1.node, c2.node) > 0;
+}
+
+void NAryExpressionNode::bubbleSortChildrenInPlace(ExpressionOrder order, Context * context, bool canSwapMatrices) {
   Expression reference(this);
   const int childrenCount = reference.numberOfChildren();
   for (int i = 1; i < childrenCount; i++) {
     bool isSorted = true;
     for (int j = 0; j < childrenCount-1; j++) {
-      /* Warning: Matrix operations are not always commutative (ie,
-       * multiplication) so we never swap 2 matrices. */
       ExpressionNode * cj = childAtIndex(j);
       ExpressionNode * cj1 = childAtIndex(j+1);
-      bool cjIsMatrix = Expression(cj).deepIsMatrix(context);
-      bool cj1IsMatrix = Expression(cj1).deepIsMatrix(context);
-      bool cj1GreaterThanCj = order(cj, cj1) > 0;
-      if ((cjIsMatrix && !cj1IsMatrix) || // we always put matrices at the end of expressions
-          (cjIsMatrix && cj1IsMatrix && canSwapMatrices && cj1GreaterThanCj) ||
-          (!cjIsMatrix && !cj1IsMatrix && cj1GreaterThanCj)) {
+      SortedChild c1 = {cj, Expression(cj).deepIsMatrix(context)};
+      SortedChild c2 = {cj1, Expression(cj1).deepIsMatrix(context)};
+      if (ComesAfter(c1, c2, order, canSwapMatrices)) {
         reference.swapChildrenInPlace(j, j+1);
         isSorted = false;
       }
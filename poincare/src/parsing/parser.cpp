@@ -25,16 +25,15 @@ bool Parser::IsReservedName(const char * name, size_t nameLength) {
 // Private
 
 const Expression::FunctionHelper * const * Parser::GetReservedFunction(const char * name, size_t nameLength) {
-  const Expression::FunctionHelper * const * reservedFunction = s_reservedFunctions;
-  while (reservedFunction < s_reservedFunctionsUpperBound) {
-    int nameDifference = Token::CompareNonNullTerminatedName(name, nameLength, (**reservedFunction).name());
-    if (nameDifference == 0) {
-      return reservedFunction;
-    }
-    if (nameDifference < 0) {
-      break;
-    }
-    reservedFunction++;
+  static_assert(ReservedFunctionsAreSorted(s_reservedFunctions, s_reservedFunctionsUpperBound), "The reserved functions must be sorted by name");
+  /* Binary search for the first reserved function with this name, as
+   * parseReservedFunction tries the next ones if it has more parameters. */
+  const Expression::FunctionHelper * const * reservedFunction = std::lower_bound(s_reservedFunctions, s_reservedFunctionsUpperBound, name,
+    [nameLength](const Expression::FunctionHelper * helper, const char * name) {
+      return Token::CompareNonNullTerminatedName(name, nameLength, helper->name()) > 0;
+    });
+  if (reservedFunction < s_reservedFunctionsUpperBound && Token::CompareNonNullTerminatedName(name, nameLength, (**reservedFunction).name()) == 0) {
+    return reservedFunction;
   }
   return nullptr;
 }
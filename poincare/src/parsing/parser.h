@@ -36,6 +36,13 @@ public:
 
 private:
   static const Expression::FunctionHelper * const * GetReservedFunction(const char * name, size_t nameLength);
+  // Compare as strcmp does, with unsigned chars
+  constexpr static int CompareNames(const char * name1, const char * name2) {
+    return (*name1 != *name2 || *name1 == 0) ? static_cast<unsigned char>(*name1) - static_cast<unsigned char>(*name2) : CompareNames(name1 + 1, name2 + 1);
+  }
+  constexpr static bool ReservedFunctionsAreSorted(const Expression::FunctionHelper * const * first, const Expression::FunctionHelper * const * last) {
+    return last - first < 2 || (CompareNames((*first)->name(), (*(first + 1))->name()) <= 0 && ReservedFunctionsAreSorted(first + 1, last));
+  }
   static bool IsSpecialIdentifierName(const char * name, size_t nameLength);
 
   Expression parseUntil(Token::Type stoppingType);
@@ -163,10 +170,10 @@ private:
     &SquareRoot::s_functionHelper
   };
   static constexpr const Expression::FunctionHelper * const * s_reservedFunctionsUpperBound = s_reservedFunctions + (sizeof(s_reservedFunctions)/sizeof(Expression::FunctionHelper *));
-  /* The method GetReservedFunction passes through the successive
-   * entries of the above array in order to determine whether m_currentToken
-   * corresponds to an entry. As a helper, the static constexpr
-   * s_reservedFunctionsUpperBound marks the end of the array. */
+  /* The method GetReservedFunction searches the above array, which is sorted
+   * by name, in order to determine whether m_currentToken corresponds to an
+   * entry. As a helper, the static constexpr s_reservedFunctionsUpperBound
+   * marks the end of the array. */
 };
 
 }
@@ -2,6 +2,7 @@
 #include <poincare/addition.h>
 #include <poincare/arithmetic.h>
 #include <poincare/complex_argument.h>
+#include <poincare/complex.h>
 #include <poincare/complex_cartesian.h>
 #include <poincare/division.h>
 #include <poincare/float.h>
@@ -13,7 +14,13 @@
 #include <poincare/real_part.h>
 #include <poincare/square_root.h>
 #include <poincare/subtraction.h>
+#include <poincare/symbol.h>
 #include <poincare/undefined.h>
+#include <poincare/variable_context.h>
+#include <algorithm>
+#include <float.h>
+#include <math.h>
+#include <string.h>
 
 namespace Poincare {
 
@@ -344,6 +351,244 @@ int Polynomial::CubicPolynomialRoots(Expression a, Expression b, Expression c, E
   return !root1->isUndefined() + !root2->isUndefined() + !root3->isUndefined();
 }
 
+int Polynomial::ApproximateRealRoots(const Expression & polynomial, const char * symbol, int degree, double * roots, Context * context, Preferences::AngleUnit angleUnit) {
+  assert(0 < degree && degree <= k_maxApproximatedDegree);
+  std::complex<double> coefficients[k_maxApproximatedDegree + 1];
+  /* Interpolate on the unit circle first. If the roots are far from it, the
+   * values there lose the small coefficients to rounding: interpolate again on
+   * a circle of the order of magnitude of the roots. */
+  double radius = 1.0;
+  int effectiveDegree;
+  int valuation;
+  for (int pass = 0; pass < 2; pass++) {
+    if (!InterpolateCoefficients(polynomial, symbol, degree, radius, coefficients, context, angleUnit)) {
+      return -1;
+    }
+    effectiveDegree = degree;
+    while (effectiveDegree > 0 && coefficients[effectiveDegree] == 0.0) {
+      effectiveDegree--;
+    }
+    valuation = 0;
+    while (valuation < effectiveDegree && coefficients[valuation] == 0.0) {
+      valuation++;
+    }
+    if (valuation == effectiveDegree) {
+      break;
+    }
+    double rootsMagnitude = std::pow(std::abs(coefficients[valuation] / coefficients[effectiveDegree]), 1.0 / (effectiveDegree - valuation));
+    if (pass > 0 || (rootsMagnitude >= 0.25 && rootsMagnitude <= 4.0)) {
+      break;
+    }
+    radius = rootsMagnitude;
+  }
+  if (coefficients[effectiveDegree] == 0.0) {
+    // The polynomial is null on the circle
+    return -1;
+  }
+
+  std::complex<double> complexRoots[k_maxApproximatedDegree];
+  double errorBounds[k_maxApproximatedDegree];
+  int numberOfComplexRoots = effectiveDegree > valuation ? ApproximateRoots(coefficients + valuation, effectiveDegree - valuation, complexRoots, errorBounds) : 0;
+  int numberOfRoots = 0;
+  if (valuation > 0) {
+    roots[numberOfRoots++] = 0.0;
+  }
+  for (int i = 0; i < numberOfComplexRoots; i++) {
+    double x = complexRoots[i].real();
+    // A root is real if its error disc meets the real axis
+    if (std::fabs(complexRoots[i].imag()) > errorBounds[i]) {
+      continue;
+    }
+    // Insert the root in order, merging it with a root within its error disc
+    int j = numberOfRoots;
+    while (j > 0 && roots[j-1] > x) {
+      j--;
+    }
+    if ((j > 0 && x - roots[j-1] <= errorBounds[i]) || (j < numberOfRoots && roots[j] - x <= errorBounds[i])) {
+      continue;
+    }
+    for (int k = numberOfRoots; k > j; k--) {
+      roots[k] = roots[k-1];
+    }
+    roots[j] = x;
+    numberOfRoots++;
+  }
+  return numberOfRoots;
+}
+
+int Polynomial::ApproximateRoots(const std::complex<double> * coefficients, int degree, std::complex<double> * roots, double * errorBounds) {
+  assert(0 < degree && degree <= k_maxApproximatedDegree && coefficients[degree] != 0.0);
+  // All the roots lie in the disc of this radius
+  double radius = 0.0;
+  for (int j = 0; j < degree; j++) {
+    radius = std::max(radius, std::pow(std::abs(coefficients[j] / coefficients[degree]), 1.0 / (degree - j)));
+  }
+  if (radius == 0.0) {
+    roots[0] = 0.0;
+    errorBounds[0] = 0.0;
+    return 1;
+  }
+  for (int k = 0; k < degree; k++) {
+    roots[k] = std::polar(radius, 2.0 * M_PI * k / degree + k_startingAngle);
+  }
+
+  /* Aberth-Ehrlich iteration: each root follows Newton's step on the
+   * polynomial divided by the other roots. Updated roots are used as soon as
+   * they are computed. A root stops moving once the polynomial value is of
+   * the order of its rounding error. */
+  const double roundingErrorFactor = RoundingErrorFactor(degree);
+  bool converged[k_maxApproximatedDegree] = {};
+  std::complex<double> value, derivative;
+  double roundingErrorBound;
+  for (int iteration = 0; iteration < k_maxNumberOfAberthIterations; iteration++) {
+    bool allConverged = true;
+    for (int k = 0; k < degree; k++) {
+      if (converged[k]) {
+        continue;
+      }
+      EvaluateApproximatePolynomial(coefficients, degree, roots[k], &value, &derivative, &roundingErrorBound);
+      if (std::abs(value) <= roundingErrorFactor * roundingErrorBound) {
+        converged[k] = true;
+        continue;
+      }
+      allConverged = false;
+      std::complex<double> repulsion = 0.0;
+      for (int j = 0; j < degree; j++) {
+        if (j != k) {
+          repulsion += 1.0 / (roots[k] - roots[j]);
+        }
+      }
+      roots[k] -= 1.0 / (derivative / value - repulsion);
+    }
+    if (allConverged) {
+      break;
+    }
+  }
+
+  /* A root of multiplicity m is approximated by m roots spread around it. Any
+   * disc of radius degree*|p(z)/p'(z)| around z contains a root of p: merge
+   * the roots whose discs meet. */
+  int cluster[k_maxApproximatedDegree];
+  for (int k = 0; k < degree; k++) {
+    EvaluateApproximatePolynomial(coefficients, degree, roots[k], &value, &derivative, &roundingErrorBound);
+    double absoluteDerivative = std::abs(derivative);
+    errorBounds[k] = absoluteDerivative > 0.0 ? degree * (std::abs(value) + roundingErrorFactor * roundingErrorBound) / absoluteDerivative : INFINITY;
+    cluster[k] = k;
+    for (int j = 0; j < k; j++) {
+      if (cluster[j] != cluster[k] && std::abs(roots[k] - roots[j]) <= errorBounds[k] + errorBounds[j]) {
+        // A cluster is labelled by its first root
+        int merged = std::max(cluster[j], cluster[k]);
+        int label = std::min(cluster[j], cluster[k]);
+        for (int i = 0; i <= k; i++) {
+          if (cluster[i] == merged) {
+            cluster[i] = label;
+          }
+        }
+      }
+    }
+  }
+
+  int numberOfRoots = 0;
+  std::complex<double> derivativeCoefficients[k_maxApproximatedDegree + 1];
+  for (int k = 0; k < degree; k++) {
+    if (cluster[k] != k) {
+      continue;
+    }
+    std::complex<double> center = 0.0;
+    double errorBound = 0.0;
+    int multiplicity = 0;
+    for (int j = k; j < degree; j++) {
+      if (cluster[j] == k) {
+        center += roots[j];
+        errorBound = std::max(errorBound, errorBounds[j]);
+        multiplicity++;
+      }
+    }
+    center /= static_cast<double>(multiplicity);
+    if (multiplicity > 1) {
+      /* A root of multiplicity m is a simple root of the (m-1)-th derivative:
+       * Newton's method on it refines the center of the cluster. */
+      int derivativeDegree = degree - multiplicity + 1;
+      for (int j = 0; j <= derivativeDegree; j++) {
+        double factor = 1.0;
+        for (int i = j + 1; i < j + multiplicity; i++) {
+          factor *= i;
+        }
+        derivativeCoefficients[j] = factor * coefficients[j + multiplicity - 1];
+      }
+      for (int step = 0; step < k_numberOfMultipleRootNewtonSteps; step++) {
+        EvaluateApproximatePolynomial(derivativeCoefficients, derivativeDegree, center, &value, &derivative, &roundingErrorBound);
+        if (derivative == 0.0) {
+          break;
+        }
+        center -= value / derivative;
+      }
+    }
+    roots[numberOfRoots] = center;
+    errorBounds[numberOfRoots] = errorBound;
+    numberOfRoots++;
+  }
+  return numberOfRoots;
+}
+
+bool Polynomial::InterpolateCoefficients(const Expression & polynomial, const char * symbol, int degree, double radius, std::complex<double> * coefficients, Context * context, Preferences::AngleUnit angleUnit) {
+  /* Evaluate the polynomial on the degree+1 points radius*w^k, where w is a
+   * primitive root of unity: the coefficients are the discrete Fourier
+   * transform of the values. */
+  const int numberOfPoints = degree + 1;
+  std::complex<double> values[k_maxApproximatedDegree + 1];
+  double maxValue = 0.0;
+  VariableContext variableContext(symbol, context);
+  Symbol variable = Symbol::Builder(symbol, strlen(symbol));
+  for (int k = 0; k < numberOfPoints; k++) {
+    std::complex<double> z = std::polar(radius, 2.0 * M_PI * k / numberOfPoints);
+    variableContext.setExpressionForSymbolAbstract(ComplexCartesian::Builder(Float<double>::Builder(z.real()), Float<double>::Builder(z.imag())), variable);
+    Evaluation<double> evaluation = polynomial.approximateToEvaluation<double>(&variableContext, Preferences::ComplexFormat::Cartesian, angleUnit);
+    if (evaluation.type() != EvaluationNode<double>::Type::Complex) {
+      return false;
+    }
+    values[k] = *static_cast<ComplexNode<double> *>(evaluation.node());
+    if (!std::isfinite(values[k].real()) || !std::isfinite(values[k].imag())) {
+      return false;
+    }
+    maxValue = std::max(maxValue, std::abs(values[k]));
+  }
+  const double roundingErrorFactor = RoundingErrorFactor(degree);
+  double radiusPower = 1.0;
+  for (int j = 0; j < numberOfPoints; j++) {
+    std::complex<double> coefficient = 0.0;
+    for (int k = 0; k < numberOfPoints; k++) {
+      coefficient += values[k] * std::polar(1.0, -2.0 * M_PI * ((j * k) % numberOfPoints) / numberOfPoints);
+    }
+    coefficient /= numberOfPoints * radiusPower;
+    /* Parts of coefficients lost in the rounding errors of the values are
+     * null: this keeps the coefficients of real polynomials real. */
+    double roundingError = roundingErrorFactor * maxValue / radiusPower;
+    coefficients[j] = std::complex<double>(
+        std::fabs(coefficient.real()) <= roundingError ? 0.0 : coefficient.real(),
+        std::fabs(coefficient.imag()) <= roundingError ? 0.0 : coefficient.imag());
+    radiusPower *= radius;
+  }
+  return true;
+}
+
+double Polynomial::RoundingErrorFactor(int degree) {
+  return 16.0 * (degree + 1) * DBL_EPSILON;
+}
+
+void Polynomial::EvaluateApproximatePolynomial(const std::complex<double> * coefficients, int degree, std::complex<double> z, std::complex<double> * value, std::complex<double> * derivative, double * roundingErrorBound) {
+  // Horner's scheme, with the sum of the absolute values of the terms
+  double absoluteZ = std::abs(z);
+  *value = coefficients[degree];
+  *derivative = 0.0;
+  *roundingErrorBound = std::abs(coefficients[degree]);
+  for (int j = degree - 1; j >= 0; j--) {
+    *derivative = *derivative * z + *value;
+    *value = *value * z + coefficients[j];
+    *roundingErrorBound = *roundingErrorBound * absoluteZ + std::abs(coefficients[j]);
+  }
+}
+
 Expression Polynomial::ReducePolynomial(const Expression * coefficients, int degree, Expression parameter, ExpressionNode::ReductionContext reductionContext) {
   Addition polynomial = Addition::Builder();
   polynomial.addChildAtIndexInPlace(coefficients[0].clone(), 0, 0);
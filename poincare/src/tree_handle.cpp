@@ -1,5 +1,6 @@
 #include <poincare/tree_handle.h>
 #include <poincare/ghost.h>
+#include <poincare/helpers.h>
 #include <poincare_expressions.h>
 #include <poincare_layouts.h>
 
@@ -128,6 +129,42 @@ void TreeHandle::swapChildrenInPlace(int i, int j) {
   TreePool::sharedPool()->move(childAtIndex(secondChildIndex).node()->nextSibling(), firstChild.node(), firstChild.numberOfChildren());
 }
 
+void TreeHandle::permuteChildrenInPlace(uint16_t * permutation) {
+  /* Rotate each child to its final place, then register the moved nodes once,
+   * instead of after every move as swaps do. */
+  const int childrenCount = numberOfChildren();
+  TreeNode * destination = childrenCount > 0 ? node()->childAtIndex(0) : nullptr;
+  TreeNode * firstMovedNode = nullptr;
+  for (int k = 0; k < childrenCount; k++) {
+    // The children from index k on are not placed yet
+    int index = permutation[k];
+    assert(index >= k && index < childrenCount);
+    TreeNode * child = destination;
+    for (int i = k; i < index; i++) {
+      child = child->nextSibling();
+    }
+    size_t childSize = child->deepSize(child->numberOfChildren());
+    if (child != destination) {
+      assert(TreePool::IsAfterTopmostCheckpoint(destination));
+      assert(childSize % 4 == 0);
+      Helpers::Rotate(reinterpret_cast<uint32_t *>(destination), reinterpret_cast<uint32_t *>(child), childSize/4);
+      if (firstMovedNode == nullptr) {
+        firstMovedNode = destination;
+      }
+      // The children between index k and the child moved one index further
+      for (int j = k + 1; j < childrenCount; j++) {
+        if (permutation[j] < index) {
+          permutation[j]++;
+        }
+      }
+    }
+    destination = reinterpret_cast<TreeNode *>(reinterpret_cast<char *>(destination) + childSize);
+  }
+  if (firstMovedNode != nullptr) {
+    TreePool::sharedPool()->updateNodeForIdentifierFromNode(firstMovedNode);
+  }
+}
+
 #if POINCARE_TREE_LOG
 void TreeHandle::log() const {
   node()->log(std::cout);
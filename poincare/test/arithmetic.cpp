@@ -91,7 +91,7 @@ void assert_divisors_equal_to(Integer a, int const (&divisors)[N]) {
   }
 }
 
-QUIZ_CASE(poincare_arithmetic_gcd) {
+QUIZ_THREAD_SAFE_CASE(poincare_arithmetic_gcd) {
   assert_gcd_equals_to(Integer(11), Integer(121), Integer(11));
   assert_gcd_equals_to(Integer(-256), Integer(321), Integer(1));
   assert_gcd_equals_to(Integer(-8), Integer(-40), Integer(8));
@@ -99,7 +99,7 @@ QUIZ_CASE(poincare_arithmetic_gcd) {
   assert_gcd_equals_to(Integer("45678998789"), Integer("1461727961248"), Integer("45678998789"));
 }
 
-QUIZ_CASE(poincare_arithmetic_lcm) {
+QUIZ_THREAD_SAFE_CASE(poincare_arithmetic_lcm) {
   assert_lcm_equals_to(Integer(11), Integer(121), Integer(121));
   assert_lcm_equals_to(Integer(-31), Integer(52), Integer(1612));
   assert_lcm_equals_to(Integer(-8), Integer(-40), Integer(40));
@@ -108,7 +108,7 @@ QUIZ_CASE(poincare_arithmetic_lcm) {
   assert_lcm_equals_to(Integer(24278576), Integer(23334), Integer("283258146192"));
 }
 
-QUIZ_CASE(poincare_arithmetic_factorization) {
+QUIZ_THREAD_SAFE_CASE(poincare_arithmetic_factorization) {
   assert_lcm_equals_to(Integer("45678998789"), Integer("1461727961248"), Integer("1461727961248"));
   int factors0[5] = {2,3,5,79,1319};
   int coefficients0[5] = {2,1,1,1,1};
@@ -136,7 +136,7 @@ QUIZ_CASE(poincare_arithmetic_factorization) {
   assert_prime_factorization_equals_to(Integer(1), factors7, coefficients7, 0);
 }
 
-QUIZ_CASE(poincare_arithmetic_divisors) {
+QUIZ_THREAD_SAFE_CASE(poincare_arithmetic_divisors) {
   quiz_assert_print_if_failure(Arithmetic().PositiveDivisors(Integer(0)) == Arithmetic::k_errorTooManyFactors, "divisors(0)");
   assert_divisors_equal_to(Integer(1), {1});
   assert_divisors_equal_to(Integer(2), {1, 2});
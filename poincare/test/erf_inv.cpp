@@ -5,7 +5,7 @@
 
 using namespace Poincare;
 
-QUIZ_CASE(erf_inv) {
+QUIZ_THREAD_SAFE_CASE(erf_inv) {
   quiz_assert(erfInv(0.0) == 0.0);
   quiz_assert(std::isinf(erfInv(1.0))  && erfInv(1.0) > 0.0);
   quiz_assert(std::isinf(erfInv(-1.0)) && erfInv(-1.0) < 0.0);
@@ -223,4 +223,18 @@ QUIZ_CASE(poincare_expression_order_addition_multiplication) {
     Expression e2 = Addition::Builder(child2, child1);
     assert_multiplication_or_addition_is_ordered_as(e1, e2);
   }
+
+  {
+    // 0 + 1 + ... + n -> n + ... + 1 + 0, with more children than sorted by index too
+    constexpr int numberOfChildren[] = {40, 70};
+    for (int n : numberOfChildren) {
+      Addition e1 = Addition::Builder();
+      Addition e2 = Addition::Builder();
+      for (int i = 0; i < n; i++) {
+        e1.addChildAtIndexInPlace(Rational::Builder(i), i, i);
+        e2.addChildAtIndexInPlace(Rational::Builder(n - 1 - i), i, i);
+      }
+      assert_multiplication_or_addition_is_ordered_as(e1, e2);
+    }
+  }
 }
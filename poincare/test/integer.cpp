@@ -8,7 +8,7 @@ using namespace Poincare;
 static inline Integer MaxInteger() { return Integer(MaxIntegerString()); }
 static inline Integer OverflowedInteger() { return Integer(OverflowedIntegerString()); }
 
-QUIZ_CASE(poincare_integer_constructor) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_constructor) {
   Integer zero;
   Integer a("123");
   Integer na("-123");
@@ -39,7 +39,7 @@ static inline void assert_greater(const Integer i, const Integer j) {
   quiz_assert(Integer::NaturalOrder(i, j) > 0);
 }
 
-QUIZ_CASE(poincare_integer_compare) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_compare) {
   assert_equal(Integer(123), Integer(123));
   assert_equal(Integer(-123), Integer(-123));
   assert_equal(Integer("123"), Integer(123));
@@ -62,7 +62,7 @@ QUIZ_CASE(poincare_integer_compare) {
   //FIXME: quiz_assert(Integer("0b1011") == Integer(11));
 }
 
-QUIZ_CASE(poincare_integer_properties) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_properties) {
   quiz_assert(Integer(0).isZero());
   quiz_assert(!Integer(-1).isZero());
   quiz_assert(!Integer(1).isZero());
@@ -85,7 +85,7 @@ static inline void assert_add_to(const Integer i, const Integer j, const Integer
   quiz_assert(Integer::NaturalOrder(Integer::Addition(i, j), k) == 0);
 }
 
-QUIZ_CASE(poincare_integer_addition) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_addition) {
   assert_add_to(Integer("0"), Integer("0"), Integer(0));
   assert_add_to(Integer(123), Integer(456), Integer(579));
   assert_add_to(Integer(123), Integer(456), Integer(579));
@@ -113,7 +113,7 @@ static inline void assert_sub_to(const Integer i, const Integer j, const Integer
   quiz_assert(Integer::NaturalOrder(Integer::Subtraction(i, j), k) == 0);
 }
 
-QUIZ_CASE(poincare_integer_subtraction) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_subtraction) {
   assert_sub_to(Integer(123), Integer(23), Integer(100));
   assert_sub_to(Integer("123456789123456789"), Integer("9999999999"), Integer("123456779123456790"));
   assert_sub_to(Integer(23), Integer(100), Integer(-77));
@@ -147,7 +147,7 @@ static inline void assert_mult_to(const Integer i, const Integer j, const Intege
   quiz_assert(Integer::NaturalOrder(Integer::Multiplication(i, j), k) == 0);
 }
 
-QUIZ_CASE(poincare_integer_multiplication) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_multiplication) {
   assert_mult_to(Integer(12), Integer(34), Integer(408));
   assert_mult_to(Integer(56), Integer(0), Integer(0));
   assert_mult_to(Integer(-12), Integer(34), Integer(-408));
@@ -165,7 +165,7 @@ static inline void assert_div_to(const Integer i, const Integer j, const Integer
   quiz_assert(Integer::NaturalOrder(Integer::Division(i, j).remainder, r) == 0);
 }
 
-QUIZ_CASE(poincare_integer_divide) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_divide) {
   assert_div_to(Integer("146097313984800"), Integer(720), Integer("202912936090"), Integer(0));
   assert_div_to(Integer(8), Integer(4), Integer(2), Integer(0));
   assert_div_to(Integer("3293920983030066"), Integer(38928), Integer("84615726033"), Integer(17442));
@@ -195,7 +195,7 @@ static inline void assert_pow_to(const Integer i, const Integer j, const Integer
   quiz_assert(Integer::NaturalOrder(Integer::Power(i, j), k) == 0);
 }
 
-QUIZ_CASE(poincare_integer_pow) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_pow) {
   assert_pow_to(Integer(0), Integer(14), Integer(0));
   assert_pow_to(Integer(14), Integer(0), Integer(1));
   assert_pow_to(Integer(2), Integer(2), Integer(4));
@@ -207,7 +207,7 @@ static inline void assert_factorial_to(const Integer i, const Integer j) {
   quiz_assert(Integer::NaturalOrder(Integer::Factorial(i), j) == 0);
 }
 
-QUIZ_CASE(poincare_integer_factorial) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_factorial) {
   assert_factorial_to(Integer(5), Integer(120));
   assert_factorial_to(Integer(123), Integer("12146304367025329675766243241881295855454217088483382315328918161829235892362167668831156960612640202170735835221294047782591091570411651472186029519906261646730733907419814952960000000000000000000000000000"));
 }
@@ -219,7 +219,7 @@ void assert_integer_evals_to(const char * i, T result, Integer::Base base = Inte
   quiz_assert(Integer(i, strlen(i), false, base).approximate<T>() == result);
 }
 
-QUIZ_CASE(poincare_integer_evaluate) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_evaluate) {
   assert_integer_evals_to("1", 1.0f);
   assert_integer_evals_to("1", 1.0);
   assert_integer_evals_to("12345678", 12345678.0f);
@@ -272,7 +272,7 @@ static inline void assert_integer_serializes_to(const Integer i, const char * se
   quiz_assert(strcmp(buffer, serialization) == 0);
 }
 
-QUIZ_CASE(poincare_integer_serialize) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_serialize) {
   assert_integer_serializes_to(Integer(-2), "-2");
   assert_integer_serializes_to(Integer("2345678909876"), "2345678909876");
   assert_integer_serializes_to(Integer("-2345678909876"), "-2345678909876");
@@ -290,7 +290,7 @@ void assert_division_computes_to(int n, int m, const char * div) {
   assert_expression_serialize_to(Integer::CreateEuclideanDivision(Integer(n), Integer(m)), div);
 }
 
-QUIZ_CASE(poincare_integer_euclidian_division) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_euclidian_division) {
   assert_division_computes_to(47, 8, "47=8×5+7");
   assert_division_computes_to(1, 5, "1=5×0+1");
   assert_division_computes_to(12, 4, "12=4×3+0");
@@ -303,7 +303,7 @@ void assert_mixed_fraction_computes_to(int n, int m, const char * frac) {
   assert_expression_serialize_to(Integer::CreateMixedFraction(Integer(n), Integer(m)), frac);
 }
 
-QUIZ_CASE(poincare_integer_mixed_fraction) {
+QUIZ_THREAD_SAFE_CASE(poincare_integer_mixed_fraction) {
   assert_mixed_fraction_computes_to(47, 8, "5+7/8");
   assert_mixed_fraction_computes_to(1, 5, "0+1/5");
   assert_mixed_fraction_computes_to(-33, 7, "-4-5/7");
@@ -72,3 +72,44 @@ QUIZ_CASE(poincare_polynomial_roots_cubic) {
   assert_roots_of_polynomial_are("x^3+x^2+x-39999999", {"3.416612ᴇ2", "-1.713306ᴇ2-2.961771ᴇ2×𝐢", "-1.713306ᴇ2+2.961771ᴇ2×𝐢"}, "-43199998400000016", Cartesian);
   assert_roots_of_polynomial_are("(x-π)(x^2+x+1-𝐢^(2/30))", {"3.141593", "-1.005197-1.034531ᴇ-1×𝐢", "5.197423ᴇ-3+1.034531ᴇ-1×𝐢"}, "1.668482ᴇ2+6.817647ᴇ1×𝐢", Cartesian);
 }
+
+template <int N>
+void assert_real_roots_of_polynomial_approximate_to(const char * polynomial, const double (&roots)[N], double precision = 1E-9) {
+  Shared::GlobalContext context;
+  ExpressionNode::ReductionContext reductionContext(&context, Cartesian, Radian, Metric, SystemForApproximation);
+  Expression polynomialExp = parse_expression(polynomial, &context, false).reduce(reductionContext);
+  int degree = polynomialExp.polynomialDegree(&context, "x");
+  double rootsApproximation[Polynomial::k_maxApproximatedDegree];
+  int numberOfRoots = Polynomial::ApproximateRealRoots(polynomialExp, "x", degree, rootsApproximation, &context, Radian);
+  int targetNumberOfRoots = (N == 1 && std::isnan(roots[0])) ? 0 : N;
+  quiz_assert_print_if_failure(numberOfRoots == targetNumberOfRoots, polynomial);
+  for (int i = 0; i < targetNumberOfRoots; i++) {
+    quiz_assert_print_if_failure(std::fabs(rootsApproximation[i] - roots[i]) <= precision * std::max(1.0, std::fabs(roots[i])), polynomial);
+  }
+}
+
+QUIZ_CASE(poincare_polynomial_roots_approximate) {
+  assert_real_roots_of_polynomial_approximate_to("x^4-5x^2+4", {-2.0, -1.0, 1.0, 2.0});
+  assert_real_roots_of_polynomial_approximate_to("x^4+1", {NAN});
+  assert_real_roots_of_polynomial_approximate_to("x^5-x-1", {1.1673039782614187});
+  assert_real_roots_of_polynomial_approximate_to("x^2×(x-3)(x-4)(x-5)", {0.0, 3.0, 4.0, 5.0});
+  assert_real_roots_of_polynomial_approximate_to("(x^2+10^(-10))(x-2)(x-3)", {2.0, 3.0});
+  assert_real_roots_of_polynomial_approximate_to("(x-0.001)(x-0.002)(x-5)(x-1000)", {0.001, 0.002, 5.0, 1000.0});
+  assert_real_roots_of_polynomial_approximate_to("(x-10^6)(x-2×10^6)(x+3×10^6)", {-3E6, 1E6, 2E6});
+  // Multiple roots are less precise
+  assert_real_roots_of_polynomial_approximate_to("(x-10)^7", {10.0}, 1E-7);
+  assert_real_roots_of_polynomial_approximate_to("(x-1)^5(x-2)^3(x-3)^2", {1.0, 2.0, 3.0}, 1E-7);
+  assert_real_roots_of_polynomial_approximate_to("(x-1.5)^2(x+1)^3(x-4)^2(x-0.1)", {-1.0, 0.1, 1.5, 4.0}, 1E-7);
+  // Complex coefficients
+  assert_real_roots_of_polynomial_approximate_to("(x-𝐢)(x+2)(x^3-1)", {-2.0, 1.0});
+
+  std::complex<double> coefficients[] = {std::complex<double>(0.0, -6.0), std::complex<double>(11.0, 0.0), std::complex<double>(0.0, 6.0), -1.0};
+  std::complex<double> roots[3];
+  double errorBounds[3];
+  // Roots of -(x-𝐢)(x-2𝐢)(x-3𝐢)
+  quiz_assert(Polynomial::ApproximateRoots(coefficients, 3, roots, errorBounds) == 3);
+  for (int i = 0; i < 3; i++) {
+    std::complex<double> root = roots[i];
+    quiz_assert(std::fabs(root.real()) < 1E-12 && std::fabs(root.imag() - std::round(root.imag())) < 1E-12 && errorBounds[i] < 1E-10);
+  }
+}
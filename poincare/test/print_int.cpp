@@ -22,7 +22,7 @@ void assert_int_prints_as(int integer, const char * result, bool left) {
   }
 }
 
-QUIZ_CASE(poincare_print_int_left) {
+QUIZ_THREAD_SAFE_CASE(poincare_print_int_left) {
   assert_int_prints_as(1, "1", true);
   assert_int_prints_as(12, "12", true);
   assert_int_prints_as(15678, "15678", true);
@@ -30,7 +30,7 @@ QUIZ_CASE(poincare_print_int_left) {
   assert_int_prints_as(0, "0", true);
 }
 
-QUIZ_CASE(poincare_print_int_right) {
+QUIZ_THREAD_SAFE_CASE(poincare_print_int_right) {
   assert_int_prints_as(1, "00001", false);
   assert_int_prints_as(12, "00012", false);
   assert_int_prints_as(15678, "15678", false);
@@ -18,7 +18,7 @@ static inline void assert_greater(const Rational i, const Rational j) {
   quiz_assert(Rational::NaturalOrder(i, j) > 0);
 }
 
-QUIZ_CASE(poincare_rational_order) {
+QUIZ_THREAD_SAFE_CASE(poincare_rational_order) {
   assert_equal(Rational::Builder(123,324), Rational::Builder(41,108));
   assert_not_equal(Rational::Builder(123,234), Rational::Builder(42, 108));
   assert_lower(Rational::Builder(123,234), Rational::Builder(456,567));
@@ -27,7 +27,7 @@ QUIZ_CASE(poincare_rational_order) {
   assert_greater(Rational::Builder(123, 234),Rational::Builder("123456789123456789", "12345678912345678910"));
 }
 
-QUIZ_CASE(poincare_rational_specific_properties) {
+QUIZ_THREAD_SAFE_CASE(poincare_rational_specific_properties) {
   quiz_assert(Rational::Builder(0).isZero());
   quiz_assert(!Rational::Builder(231).isZero());
   quiz_assert(Rational::Builder(1).isOne());
@@ -54,7 +54,7 @@ static inline void assert_add_to(const Rational i, const Rational j, const Ratio
   quiz_assert(Rational::NaturalOrder(Rational::Addition(i, j), k) == 0);
 }
 
-QUIZ_CASE(poincare_rational_addition) {
+QUIZ_THREAD_SAFE_CASE(poincare_rational_addition) {
   assert_add_to(Rational::Builder(1,2), Rational::Builder(1), Rational::Builder(3,2));
   assert_add_to(Rational::Builder("18446744073709551616","4294967296"), Rational::Builder(8,9), Rational::Builder("38654705672","9"));
   assert_add_to(Rational::Builder("18446744073709551616","4294967296"), Rational::Builder(-8,9), Rational::Builder("38654705656","9"));
@@ -64,7 +64,7 @@ static inline void assert_pow_to(const Rational i,const Integer j, const Rationa
   quiz_assert(Rational::NaturalOrder(Rational::IntegerPower(i, j), k) == 0);
 }
 
-QUIZ_CASE(poincare_rational_power) {
+QUIZ_THREAD_SAFE_CASE(poincare_rational_power) {
   assert_pow_to(Rational::Builder(4,5), Rational::Builder(3).signedIntegerNumerator(), Rational::Builder(64,125));
   assert_pow_to(Rational::Builder(4,5), Rational::Builder(-3).signedIntegerNumerator(), Rational::Builder(125,64));
 }
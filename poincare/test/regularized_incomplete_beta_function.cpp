@@ -10,7 +10,7 @@ void assert_regularized_incomplete_beta_function_is(double a, double b, double x
   quiz_assert(std::fabs(r - result) < FLT_EPSILON/10.0);
 }
 
-QUIZ_CASE(regularized_incomplete_beta_function) {
+QUIZ_THREAD_SAFE_CASE(regularized_incomplete_beta_function) {
   assert_regularized_incomplete_beta_function_is(1.0, 2.0, 0.0, 0.0);
   assert_regularized_incomplete_beta_function_is(1.0, 2.0, 1.0, 1.0);
   assert_regularized_incomplete_beta_function_is(1.7, 0.9, 0.3, 0.114276013523787293056995598423812417112640756984394176432);
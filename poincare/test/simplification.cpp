@@ -1100,6 +1100,9 @@ QUIZ_CASE(poincare_simplification_matrix) {
   assert_parsed_expression_simplify_to("det([[1,2,3][4,5,6][7,8,9]])", "0");
   assert_parsed_expression_simplify_to("det([[1,2,3][4π,5,6][7,8,9]])", "24×π-24");
   assert_parsed_expression_simplify_to("det(identity(5))", "1");
+  assert_parsed_expression_simplify_to("det([[3,1,4,1,5,9][2,6,5,3,5,8][9,7,9,3,2,3][8,4,6,2,6,4][3,3,8,3,2,7][9,5,0,2,8,8]])", "13860");
+  assert_parsed_expression_simplify_to("det([[1/2,1/3,1,0][2,-1/4,5/6,3][0,1,2/7,-1][1,1,1,1/5]])", "-131/2520");
+  assert_parsed_expression_simplify_to("det([[1,2,3,4][2,4,6,8][1,0,0,0][0,0,0,1]])", "0");
 
   // Dimension
   assert_parsed_expression_simplify_to("dim(3)", "[[1,1]]");
@@ -1109,6 +1112,9 @@ QUIZ_CASE(poincare_simplification_matrix) {
   assert_parsed_expression_simplify_to("inverse([[1/√(2),1/2,3][2,1,-3]])", Undefined::Name());
   assert_parsed_expression_simplify_to("inverse([[1,2][3,4]])", "[[-2,1][3/2,-1/2]]");
   assert_parsed_expression_simplify_to("inverse([[π,2×π][3,2]])", "[[-1/\u00122×π\u0013,1/2][3/\u00124×π\u0013,-1/4]]");
+  assert_parsed_expression_simplify_to("inverse([[3,1,4,1,5,9][2,6,5,3,5,8][9,7,9,3,2,3][8,4,6,2,6,4][3,3,8,3,2,7][9,5,0,2,8,8]])", "[[13/1155,-123/770,27/385,-1/20,61/1155,23/231][37/315,43/210,23/105,-3/20,-101/315,-4/63][382/3465,29/1155,53/1155,1/10,-251/3465,-106/693][-2641/3465,-137/1155,-569/1155,1/5,2978/3465,214/693][-199/3465,127/1155,-206/1155,3/10,-223/3465,-50/693][17/105,-1/35,3/35,-1/5,-1/105,1/21]]");
+  assert_parsed_expression_simplify_to("inverse([[1/2,1/3,1,0][2,-1/4,5/6,3][0,1,2/7,-1][1,1,1,1/5]])", "[[-2214/131,-2136/131,-5306/131,5510/131][1068/131,1188/131,2982/131,-2910/131][882/131,672/131,1659/131,-1785/131][1320/131,1380/131,3325/131,-3420/131]]");
+  assert_parsed_expression_simplify_to("inverse([[1,2,3,4][2,4,6,8][1,0,0,0][0,0,0,1]])", Undefined::Name());
 
   // Trace
   assert_parsed_expression_simplify_to("trace([[1/√(2),1/2,3][2,1,-3]])", Undefined::Name());
@@ -9,7 +9,7 @@
 
 using namespace Poincare;
 
-QUIZ_CASE(tree_handle_are_discared_after_block) {
+QUIZ_THREAD_SAFE_CASE(tree_handle_are_discared_after_block) {
   int initialPoolSize = pool_size();
   {
     BlobByReference b = BlobByReference::Builder(0);
@@ -21,13 +21,13 @@ QUIZ_CASE(tree_handle_are_discared_after_block) {
 static void make_temp_blob() {
   BlobByReference b = BlobByReference::Builder(5);
 }
-QUIZ_CASE(tree_handle_are_discared_after_function_call) {
+QUIZ_THREAD_SAFE_CASE(tree_handle_are_discared_after_function_call) {
   int initialPoolSize = pool_size();
   make_temp_blob();
   assert_pool_size(initialPoolSize);
 }
 
-QUIZ_CASE(tree_handle_can_be_copied) {
+QUIZ_THREAD_SAFE_CASE(tree_handle_can_be_copied) {
   int initialPoolSize = pool_size();
   {
     BlobByReference b = BlobByReference::Builder(123);
@@ -38,7 +38,7 @@ QUIZ_CASE(tree_handle_can_be_copied) {
   assert_pool_size(initialPoolSize);
 }
 
-QUIZ_CASE(tree_handle_can_be_moved) {
+QUIZ_THREAD_SAFE_CASE(tree_handle_can_be_moved) {
   int initialPoolSize = pool_size();
   {
     TreeHandle t = BlobByReference::Builder(123);
@@ -56,13 +56,13 @@ static TreeHandle blob_with_data_3() {
   return BlobByReference::Builder(3);
 }
 
-QUIZ_CASE(tree_handle_can_be_returned) {
+QUIZ_THREAD_SAFE_CASE(tree_handle_can_be_returned) {
   int initialPoolSize = pool_size();
   TreeHandle b = blob_with_data_3();
   assert_pool_size(initialPoolSize+1);
 }
 
-QUIZ_CASE(tree_handle_memory_failure) {
+QUIZ_THREAD_SAFE_CASE(tree_handle_memory_failure) {
   int initialPoolSize = pool_size();
   int memoryFailureHasBeenHandled = false;
   Poincare::ExceptionCheckpoint ecp;
@@ -78,7 +78,7 @@ QUIZ_CASE(tree_handle_memory_failure) {
   assert_pool_size(initialPoolSize);
 }
 
-QUIZ_CASE(tree_handle_does_not_copy) {
+QUIZ_THREAD_SAFE_CASE(tree_handle_does_not_copy) {
   int initialPoolSize = pool_size();
   BlobByReference b1 = BlobByReference::Builder(1);
   BlobByReference b2 = BlobByReference::Builder(2);
@@ -0,0 +1,171 @@
+#include <quiz.h>
+#include <apps/code/script_template.h>
+#include <string.h>
+#include "runner.h"
+
+/* Scripts typical of what is written on the calculator. They avoid double
+ * quotes, as they are run through exec, and fit in the device heap. Each one
+ * repeats its workload so that it runs for a few tens of milliseconds on the
+ * simulator. */
+
+QUIZ_CASE(python_benchmark_numeric_loops) {
+  run_python_benchmark("numeric_loops",
+"def mandelbrot(n):\n"
+"  s = 0\n"
+"  for y in range(60):\n"
+"    for x in range(80):\n"
+"      c = complex(3.5 * x / 80 - 2.5, 2.0 * y / 60 - 1.0)\n"
+"      z = 0\n"
+"      i = 0\n"
+"      while i < n and abs(z) < 2:\n"
+"        z = z * z + c\n"
+"        i += 1\n"
+"      s += i\n"
+"  return s\n"
+"def primes(n):\n"
+"  count = 0\n"
+"  for k in range(2, n):\n"
+"    d = 2\n"
+"    while d * d <= k and k % d != 0:\n"
+"      d += 1\n"
+"    if d * d > k:\n"
+"      count += 1\n"
+"  return count\n"
+"mandelbrot(20)\n"
+"assert primes(5000) == 669\n");
+}
+
+QUIZ_CASE(python_benchmark_lists_and_dicts) {
+  run_python_benchmark("lists_and_dicts",
+"def run():\n"
+"  l = [(i * 7919) % 1000 for i in range(500)]\n"
+"  for k in range(5):\n"
+"    s = sorted(l)\n"
+"    l.reverse()\n"
+"  assert s[0] == 0 and s[-1] == 999\n"
+"  d = {}\n"
+"  for i in range(2000):\n"
+"    k = i % 97\n"
+"    d[k] = d.get(k, 0) + i\n"
+"  assert len(d) == 97\n"
+"  t = 0\n"
+"  for k, v in d.items():\n"
+"    t += v\n"
+"  assert t == 1999000\n"
+"  m = [[i * j for j in range(20)] for i in range(20)]\n"
+"  u = [sum(r) for r in m]\n"
+"  assert u[1] == 190\n"
+"for i in range(10):\n"
+"  run()\n");
+}
+
+QUIZ_CASE(python_benchmark_string_building) {
+  run_python_benchmark("string_building",
+"def run():\n"
+"  s = ''\n"
+"  for i in range(300):\n"
+"    s += str(i)\n"
+"  assert len(s) == 790\n"
+"  parts = []\n"
+"  for i in range(100):\n"
+"    parts.append('%d:%s' % (i, hex(i)))\n"
+"  j = ','.join(parts)\n"
+"  c = 0\n"
+"  for w in j.split(','):\n"
+"    if w.upper().endswith('F'):\n"
+"      c += 1\n"
+"  assert c == 6\n"
+"for i in range(10):\n"
+"  run()\n");
+}
+
+/* The VM hook runs at each backward jump and call: a tight loop measures its
+ * overhead, the Mandelbrot template a typical drawing script. */
+QUIZ_CASE(python_benchmark_vm_hook) {
+  run_python_benchmark("vm_hook_loop",
+"for i in range(1000000):\n"
+"  pass\n");
+
+  constexpr int bufferSize = 4096;
+  char script[bufferSize];
+  int length = strlcpy(script, Code::ScriptTemplate::Mandelbrot()->content(), bufferSize);
+  strlcpy(script + length, "\nmandelbrot(15)\n", bufferSize - length);
+  quiz_assert(length + 1 < bufferSize);
+  run_python_benchmark("mandelbrot_template", script);
+}
+
+QUIZ_CASE(python_benchmark_turtle) {
+  run_python_benchmark("turtle",
+"from turtle import *\n"
+"hideturtle()\n"
+"speed(0)\n"
+"for i in range(360):\n"
+"  for j in range(4):\n"
+"    forward(60)\n"
+"    left(90)\n"
+"  left(1)\n"
+"penup()\n"
+"goto(-100, -80)\n"
+"pendown()\n"
+"for r in range(10, 60, 10):\n"
+"  circle(r)\n");
+}
+
+QUIZ_CASE(python_benchmark_kandinsky) {
+  run_python_benchmark("kandinsky",
+"from kandinsky import *\n"
+"for i in range(40):\n"
+"  fill_rect(8 * i, 0, 8, 222, color(6 * i, 255 - 6 * i, 128))\n"
+"for y in range(0, 200, 2):\n"
+"  for x in range(0, 320, 2):\n"
+"    set_pixel(x, y, color(x % 256, y, (x + y) % 256))\n"
+"for y in range(0, 200, 20):\n"
+"  draw_string('Benchmark', 100, y)\n");
+}
+
+QUIZ_CASE(python_benchmark_matplotlib) {
+  run_python_benchmark("matplotlib",
+"from matplotlib.pyplot import *\n"
+"from math import sin, cos\n"
+"x = [i / 10 for i in range(100)]\n"
+"plot(x, [sin(t) for t in x])\n"
+"plot(x, [cos(t) for t in x], color = 'red')\n"
+"scatter(x[::10], [t / 20 for t in x[::10]])\n"
+"bar([1, 2, 3], [3, 1, 2])\n"
+"hist([sin(t) for t in x], 10)\n"
+"grid()\n"
+"for k in range(100):\n"
+"  text(k / 10, 1, str(k % 10))\n"
+"  show()\n");
+}
+
+QUIZ_CASE(python_benchmark_long_integers) {
+  run_python_benchmark("long_integers",
+"def run():\n"
+"  f = 1\n"
+"  for i in range(2, 300):\n"
+"    f *= i\n"
+"  assert len(str(f)) == 613\n"
+"  a, b = 0, 1\n"
+"  for i in range(1000):\n"
+"    a, b = b, a + b\n"
+"  assert a % 1000000007 == 517691607\n"
+"  m = 10 ** 40 + 7\n"
+"  p = 1\n"
+"  for i in range(1000):\n"
+"    p = p * 3 % m\n"
+"  assert p == 3 ** 1000 % m\n"
+"for i in range(10):\n"
+"  run()\n");
+}
+
+QUIZ_CASE(python_benchmark_numeric_arrays) {
+  run_python_benchmark("numeric_arrays",
+"from numarray import *\n"
+"x = zeros(2000)\n"
+"v = linspace(0, 1, 2000)\n"
+"for i in range(100):\n"
+"  x += v * 0.01\n"
+"  v *= 0.99\n"
+"assert 0.3 < x.max() < 0.7\n");
+}
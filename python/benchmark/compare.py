@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+
+# Compare the output of the python_benchmark runner to a baseline.
+#   make PLATFORM=simulator python_benchmark.bin
+#   output/release/simulator/linux/python_benchmark.bin --headless | python/benchmark/compare.py
+# The VM hook calls and GC collections are deterministic: any change means the
+# interpreter does different work. Times are noisy, so only large relative
+# changes of benchmarks long enough to be measured are reported.
+
+import argparse
+import os
+import sys
+
+def parse(lines):
+  results = {}
+  for line in lines:
+    fields = line.split()
+    if len(fields) == 5 and fields[0] == 'BENCHMARK':
+      results[fields[1]] = [int(f) for f in fields[2:]]
+  return results
+
+def format_ratio(new, old):
+  if old == 0:
+    return ''
+  return "{:+.1f} %".format(100*(new-old)/old)
+
+parser = argparse.ArgumentParser(description="Compare Python benchmark results to a baseline")
+parser.add_argument('results', nargs='?', type=argparse.FileType('r'), default=sys.stdin, help='runner output (default: standard input)')
+parser.add_argument('--baseline', default=os.path.join(os.path.dirname(__file__), 'baseline.txt'), help='baseline file')
+parser.add_argument('--update', action='store_true', help='overwrite the baseline with the results')
+parser.add_argument('--threshold', type=float, default=0.2, help='relative time change reported as significant')
+parser.add_argument('--min-time', type=int, default=10, help='time in ms below which time changes are ignored')
+args = parser.parse_args()
+
+results = parse(args.results)
+if not results:
+  sys.exit("No benchmark results found")
+
+if args.update:
+  with open(args.baseline, 'w') as f:
+    for name, (time, hook_calls, collections) in results.items():
+      f.write("BENCHMARK {} {} {} {}\n".format(name, time, hook_calls, collections))
+  sys.exit(0)
+
+with open(args.baseline) as f:
+  baseline = parse(f)
+
+significant_changes = 0
+print("{:<20} {:>8} {:>8} {:>9} {:>10} {:>9} {:>6}".format("benchmark", "ms", "base", "time", "hook calls", "change", "gc"))
+for name, (time, hook_calls, collections) in results.items():
+  if name not in baseline:
+    print("{:<20} {:>8} {:>8} {:>9} {:>10} {:>9} {:>6}  new".format(name, time, '', '', hook_calls, '', collections))
+    continue
+  base_time, base_hook_calls, base_collections = baseline[name]
+  notes = []
+  if max(time, base_time) >= args.min_time and base_time > 0 and abs(time-base_time) > args.threshold*base_time:
+    notes.append('time')
+  if hook_calls != base_hook_calls:
+    notes.append('hook calls')
+  if collections != base_collections:
+    notes.append('gc')
+  significant_changes += len(notes) > 0
+  print("{:<20} {:>8} {:>8} {:>9} {:>10} {:>9} {:>6}  {}".format(
+    name, time, base_time, format_ratio(time, base_time),
+    hook_calls, format_ratio(hook_calls, base_hook_calls),
+    "{}/{}".format(collections, base_collections) if collections != base_collections else collections,
+    ', '.join(notes)))
+for name in baseline:
+  if name not in results:
+    print("{:<20} missing".format(name))
+
+sys.exit(1 if significant_changes > 0 else 0)
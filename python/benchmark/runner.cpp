@@ -0,0 +1,101 @@
+#include "runner.h"
+#include <python/test/execution_environment.h>
+#include <python/port/helpers.h>
+#include <escher/window.h>
+#include <ion/display.h>
+#include <ion/timing.h>
+#include <quiz.h>
+#include <assert.h>
+#include <string.h>
+
+static char * appendUnsignedInteger(char * buffer, uint64_t n) {
+  char * start = buffer;
+  do {
+    *buffer++ = (n % 10) + '0';
+  } while ((n /= 10) > 0);
+  for (char * end = buffer - 1; start < end; start++, end--) {
+    char c = *start;
+    *start = *end;
+    *end = c;
+  }
+  *buffer++ = ' ';
+  return buffer;
+}
+
+/* The test environment drops the view controllers scripts display. Drawing
+ * them here accounts for the time matplotlib spends rendering plots. */
+class BenchmarkExecutionEnvironment : public TestExecutionEnvironment {
+public:
+  void displayViewController(Escher::ViewController * controller) override {
+    if (controller == nullptr) {
+      // There is no sandbox, scripts draw on the screen directly
+      return;
+    }
+    Escher::Window window;
+    window.setFrame(KDRect(0, 0, Ion::Display::Width, Ion::Display::Height), false);
+    controller->viewWillAppear();
+    window.setContentView(controller->view());
+    window.redraw(true);
+    controller->viewDidDisappear();
+  }
+};
+
+struct Measure {
+  uint64_t time;
+  uint64_t hookCalls;
+  uint32_t collections;
+};
+
+static Measure runOnce(const char * input) {
+  MicroPython::init(TestExecutionEnvironment::s_pythonHeap, TestExecutionEnvironment::s_pythonHeap + TestExecutionEnvironment::s_pythonHeapSize);
+  BenchmarkExecutionEnvironment env;
+  uint32_t collectionsBefore = MicroPython::gcStatistics().numberOfCollections;
+  uint64_t hookCallsBefore = micropython_port_vm_hook_calls();
+  uint64_t startTime = Ion::Timing::millis();
+  bool success = env.runCode(input);
+  Measure measure = {
+    Ion::Timing::millis() - startTime,
+    micropython_port_vm_hook_calls() - hookCallsBefore,
+    MicroPython::gcStatistics().numberOfCollections - collectionsBefore
+  };
+  deinit_environment();
+  if (!success) {
+    // Show the exception which stopped the script
+    quiz_print(env.lastPrintedText());
+  }
+  quiz_assert(success);
+  return measure;
+}
+
+void run_python_benchmark(const char * name, const char * script) {
+  constexpr size_t bufferSize = 4096;
+  char input[bufferSize];
+  inlineToBeSingleInput(input, bufferSize, script);
+
+  /* The fastest run is the least disturbed by the host. The counts do not
+   * depend on the run. */
+  constexpr int k_numberOfRuns = 5;
+  Measure best = runOnce(input);
+  for (int i = 1; i < k_numberOfRuns; i++) {
+    Measure measure = runOnce(input);
+    quiz_assert(measure.hookCalls == best.hookCalls && measure.collections == best.collections);
+    if (measure.time < best.time) {
+      best.time = measure.time;
+    }
+  }
+
+  constexpr char prefix[] = "BENCHMARK ";
+  constexpr size_t k_maxNameLength = 32;
+  constexpr size_t uint64ToStringMaxLength = 20;
+  char line[sizeof(prefix) + k_maxNameLength + 3 * (uint64ToStringMaxLength + 1)];
+  assert(strlen(name) < k_maxNameLength);
+  char * position = line;
+  position += strlcpy(position, prefix, sizeof(prefix));
+  position += strlcpy(position, name, k_maxNameLength);
+  *position++ = ' ';
+  position = appendUnsignedInteger(position, best.time);
+  position = appendUnsignedInteger(position, best.hookCalls);
+  position = appendUnsignedInteger(position, best.collections);
+  *(position - 1) = 0;
+  quiz_print(line);
+}
@@ -0,0 +1,12 @@
+#ifndef PYTHON_BENCHMARK_RUNNER_H
+#define PYTHON_BENCHMARK_RUNNER_H
+
+/* Run a script in a fresh MicroPython environment and print a line
+ *   BENCHMARK <name> <time in ms> <VM hook calls> <GC collections>
+ * which compare.py parses. The number of VM hook calls (one per backward jump
+ * and per call) stands for the number of bytecodes executed: unlike the time,
+ * it and the number of collections are deterministic. */
+
+void run_python_benchmark(const char * name, const char * script);
+
+#endif
@@ -107,6 +107,8 @@ Q(__reversed__)
 Q(__setitem__)
 Q(__str__)
 Q(__sub__)
+Q(__radd__)
+Q(__rsub__)
 Q(__traceback__)
 Q(_brace_open__colon__hash_b_brace_close_)
 Q(_lt_dictcomp_gt_)
@@ -371,13 +373,63 @@ Q(KEY_EE)
 Q(KEY_ANS)
 Q(KEY_EXE)
 
+// Native code emitter QSTRs
+Q(None)
+Q(ViperTypeError)
+Q(native)
+Q(ptr)
+Q(ptr16)
+Q(ptr32)
+Q(ptr8)
+Q(uint)
+Q(viper)
+
+// gc QSTRs
+Q(gc)
+Q(collect)
+Q(collections)
+Q(disable)
+Q(enable)
+Q(isenabled)
+Q(mem_alloc)
+Q(mem_free)
+Q(peak)
+Q(stats)
+Q(threshold)
+
+// Numarray QSTRs
+Q(numarray)
+Q(array)
+Q(dtype)
+Q(float32)
+Q(float64)
+Q(int16)
+Q(int32)
+Q(zeros)
+Q(linspace)
+Q(arange)
+Q(num)
+Q(sum)
+Q(min)
+Q(max)
+Q(mean)
+Q(tolist)
+
+// Profiler QSTRs
+Q(profiler)
+
 // Kandinsky QSTRs
 Q(kandinsky)
 Q(color)
+Q(double_buffer)
+Q(draw_pixels)
 Q(draw_string)
 Q(fill_rect)
 Q(get_pixel)
+Q(get_pixels)
 Q(set_pixel)
+Q(set_pixels)
+Q(show)
 
 // Matplotlib QSTRs
 Q(arrow)
@@ -414,6 +466,8 @@ Q(setheading)
 Q(seth)
 Q(circle)
 Q(speed)
+Q(tracer)
+Q(update)
 Q(position)
 Q(pos)
 Q(heading)
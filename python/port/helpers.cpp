@@ -3,6 +3,40 @@
 #include <ion.h>
 extern "C" {
 #include "mphalport.h"
+#include <py/gc.h>
+#include <py/misc.h>
+#include "mod/numarray/modnumarray.h"
+}
+#if MICROPY_EMIT_X64
+#include <sys/mman.h>
+#endif
+
+/* Reading the clock costs much more than the rest of the hook: an SVC on the
+ * device, a system call on the simulator. So the hook counts down a number of
+ * calls between two clock reads, calibrated at each read so that the clock is
+ * read about every k_clockReadPeriod ms whatever the pace of the script.
+ * The count only grows by doubling. When a read comes late, the count is
+ * scaled down to the pace just measured, so that the next read comes on time.
+ * The countdown running when a loop slows down still ends at its former
+ * count: the interruption is then checked after at most
+ * k_maxHookCallsPerClockRead calls, that is k_clockReadPeriod ms times the
+ * factor by which the loop slowed down. */
+static constexpr uint64_t k_clockReadPeriod = 10; // ms
+static constexpr uint32_t k_maxHookCallsPerClockRead = 4096;
+static constexpr uint64_t k_refreshPeriod = 100; // ms
+static uint32_t sHookCallsPerClockRead;
+static uint32_t sRemainingHookCalls;
+// Hook calls of the completed countdowns
+static uint64_t sPreviousHookCalls;
+static uint64_t sLastClockRead;
+static uint64_t sLastRefresh;
+
+void micropython_port_vm_hook_reset() {
+  sHookCallsPerClockRead = 1;
+  sRemainingHookCalls = 1;
+  sPreviousHookCalls = 0;
+  sLastClockRead = Ion::Timing::millis();
+  sLastRefresh = sLastClockRead;
 }
 
 bool micropython_port_vm_hook_loop() {
@@ -13,20 +47,38 @@ bool micropython_port_vm_hook_loop() {
   /* Doing too many things here slows down Python execution quite a lot. So we
    * only do things once in a while and return as soon as possible otherwise. */
 
-  static uint64_t t = Ion::Timing::millis();
-  static constexpr uint64_t delay = 100;
+  if (--sRemainingHookCalls > 0) {
+    return false;
+  }
+
+  sPreviousHookCalls += sHookCallsPerClockRead;
+  uint64_t t = Ion::Timing::millis();
+  uint64_t timeSinceLastClockRead = t - sLastClockRead;
+  sLastClockRead = t;
+  if (timeSinceLastClockRead > k_clockReadPeriod) {
+    sHookCallsPerClockRead = sHookCallsPerClockRead * k_clockReadPeriod / timeSinceLastClockRead;
+    if (sHookCallsPerClockRead == 0) {
+      sHookCallsPerClockRead = 1;
+    }
+  } else if (timeSinceLastClockRead < k_clockReadPeriod / 2 && sHookCallsPerClockRead < k_maxHookCallsPerClockRead) {
+    sHookCallsPerClockRead *= 2;
+  }
+  sRemainingHookCalls = sHookCallsPerClockRead;
 
-  uint64_t t2 = Ion::Timing::millis();
-  if (t2 - t < delay) {
+  if (t - sLastRefresh < k_refreshPeriod) {
     return false;
   }
-  t = t2;
+  sLastRefresh = t;
 
   micropython_port_vm_hook_refresh_print();
   // Check if the user asked for an interruption from the keyboard
   return micropython_port_interrupt_if_needed();
 }
 
+uint64_t micropython_port_vm_hook_calls() {
+  return sPreviousHookCalls + sHookCallsPerClockRead - sRemainingHookCalls;
+}
+
 void micropython_port_vm_hook_refresh_print() {
   assert(MicroPython::ExecutionEnvironment::currentExecutionEnvironment() != nullptr);
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->refreshPrintOutput();
@@ -67,6 +119,81 @@ bool micropython_port_interrupt_if_needed() {
   return false;
 }
 
+void * micropython_port_binary_op_fallback(int op, void * lhs, void * rhs) {
+  return numarray_reverse_binary_op(static_cast<mp_binary_op_t>(op), lhs, rhs);
+}
+
 int micropython_port_random() {
   return Ion::random();
 }
+
+void * micropython_port_commit_exec(void * buffer, size_t length) {
+  Ion::synchronizeInstructionCache();
+  return buffer;
+}
+
+#if MICROPY_EMIT_X64
+
+/* Native code is bump-allocated in an arena mapped once for the whole process
+ * and emptied whenever the interpreter is reset, since the code of a session
+ * lives as long as the session itself. */
+static constexpr size_t k_execArenaSize = 64*1024;
+static constexpr size_t k_execAlignment = 16;
+static uint8_t * sExecArena = nullptr;
+static size_t sExecArenaUsed = 0;
+
+static size_t alignedExecSize(size_t size) {
+  return (size + k_execAlignment - 1) & ~(k_execAlignment - 1);
+}
+
+void micropython_port_alloc_exec(size_t minSize, void ** buffer, size_t * size) {
+  if (sExecArena == nullptr) {
+    void * arena = mmap(nullptr, k_execArenaSize, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (arena == MAP_FAILED) {
+      m_malloc_fail(minSize);
+    }
+    sExecArena = static_cast<uint8_t *>(arena);
+  }
+  size_t alignedSize = alignedExecSize(minSize);
+  if (alignedSize > k_execArenaSize - sExecArenaUsed) {
+    m_malloc_fail(minSize);
+  }
+  *buffer = sExecArena + sExecArenaUsed;
+  *size = minSize;
+  sExecArenaUsed += alignedSize;
+}
+
+void micropython_port_free_exec(void * buffer, size_t size) {
+  // Only the last allocation can be given back
+  if (static_cast<uint8_t *>(buffer) + alignedExecSize(size) == sExecArena + sExecArenaUsed) {
+    sExecArenaUsed -= alignedExecSize(size);
+  }
+}
+
+void micropython_port_reset_exec() {
+  sExecArenaUsed = 0;
+}
+
+void micropython_port_gc_collect_exec() {
+  /* Native code only references heap objects through constant tables, but
+   * MicroPython requires executable memory to be scanned for roots. */
+  if (sExecArena != nullptr) {
+    gc_collect_root(reinterpret_cast<void **>(sExecArena), sExecArenaUsed/sizeof(void *));
+  }
+}
+
+#else
+
+void micropython_port_alloc_exec(size_t minSize, void ** buffer, size_t * size) {
+  *buffer = m_new(byte, minSize);
+  *size = minSize;
+}
+
+void micropython_port_free_exec(void * buffer, size_t size) {
+  m_del(byte, buffer, size);
+}
+
+void micropython_port_reset_exec() {}
+void micropython_port_gc_collect_exec() {}
+
+#endif
@@ -6,14 +6,32 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // These methods return true if they have been interrupted
 bool micropython_port_vm_hook_loop();
+// Number of calls to micropython_port_vm_hook_loop since the last reset
+uint64_t micropython_port_vm_hook_calls();
+void micropython_port_vm_hook_reset();
 void micropython_port_vm_hook_refresh_print();
 bool micropython_port_interruptible_msleep(int32_t delay);
 bool micropython_port_interrupt_if_needed();
 int micropython_port_random();
+// Return the result of lhs op rhs, or NULL if the port does not handle it
+void * micropython_port_binary_op_fallback(int op, void * lhs, void * rhs);
+
+// Sampling profiler, see profiler.h
+struct _mp_code_state_t;
+extern bool micropython_port_profiler_running;
+void micropython_port_profiler_sample(const struct _mp_code_state_t * codeState, const uint8_t * ip);
+
+// Executable memory for the native code emitters
+void * micropython_port_commit_exec(void * buffer, size_t length);
+void micropython_port_alloc_exec(size_t minSize, void ** buffer, size_t * size);
+void micropython_port_free_exec(void * buffer, size_t size);
+void micropython_port_reset_exec();
+void micropython_port_gc_collect_exec();
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,65 @@
+extern "C" {
+#include "modgc.h"
+#include <py/gc.h>
+#include <py/mpstate.h>
+#include <py/runtime.h>
+}
+#include "port.h"
+
+/* This module mirrors MicroPython's gc module, and adds stats() to measure how
+ * much a script relies on the garbage collector. */
+
+mp_obj_t modgc_collect() {
+  gc_collect();
+  return mp_const_none;
+}
+
+mp_obj_t modgc_disable() {
+  MP_STATE_MEM(gc_auto_collect_enabled) = 0;
+  return mp_const_none;
+}
+
+mp_obj_t modgc_enable() {
+  MP_STATE_MEM(gc_auto_collect_enabled) = 1;
+  return mp_const_none;
+}
+
+mp_obj_t modgc_isenabled() {
+  return mp_obj_new_bool(MP_STATE_MEM(gc_auto_collect_enabled));
+}
+
+mp_obj_t modgc_mem_alloc() {
+  gc_info_t info;
+  gc_info(&info);
+  return mp_obj_new_int(info.used);
+}
+
+mp_obj_t modgc_mem_free() {
+  gc_info_t info;
+  gc_info(&info);
+  return mp_obj_new_int(info.free);
+}
+
+mp_obj_t modgc_stats() {
+  MicroPython::GCStatistics statistics = MicroPython::gcStatistics();
+  mp_obj_t stats = mp_obj_new_dict(3);
+  mp_obj_dict_store(stats, MP_OBJ_NEW_QSTR(MP_QSTR_collections), mp_obj_new_int(statistics.numberOfCollections));
+  mp_obj_dict_store(stats, MP_OBJ_NEW_QSTR(MP_QSTR_time), mp_obj_new_float(statistics.collectionTime / 1000.0));
+  mp_obj_dict_store(stats, MP_OBJ_NEW_QSTR(MP_QSTR_peak), mp_obj_new_int(statistics.peakUsedMemory));
+  return stats;
+}
+
+/* threshold(amount) triggers a collection as soon as amount bytes have been
+ * allocated since the last one, instead of waiting for the heap to be full.
+ * threshold() returns the current value, -1 meaning disabled. */
+mp_obj_t modgc_threshold(size_t n_args, const mp_obj_t *args) {
+  if (n_args == 0) {
+    if (MP_STATE_MEM(gc_alloc_threshold) == (size_t)-1) {
+      return MP_OBJ_NEW_SMALL_INT(-1);
+    }
+    return mp_obj_new_int(MP_STATE_MEM(gc_alloc_threshold) * MICROPY_BYTES_PER_GC_BLOCK);
+  }
+  mp_int_t amount = mp_obj_get_int(args[0]);
+  MP_STATE_MEM(gc_alloc_threshold) = amount < 0 ? (size_t)-1 : amount / MICROPY_BYTES_PER_GC_BLOCK;
+  return mp_const_none;
+}
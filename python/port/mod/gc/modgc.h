@@ -0,0 +1,10 @@
+#include <py/obj.h>
+
+mp_obj_t modgc_collect();
+mp_obj_t modgc_disable();
+mp_obj_t modgc_enable();
+mp_obj_t modgc_isenabled();
+mp_obj_t modgc_mem_alloc();
+mp_obj_t modgc_mem_free();
+mp_obj_t modgc_stats();
+mp_obj_t modgc_threshold(size_t n_args, const mp_obj_t *args);
@@ -3,8 +3,12 @@ extern "C" {
 #include <py/runtime.h>
 }
 #include "port.h"
+#include "off_screen_buffer.h"
 
 #include <kandinsky/ion_context.h>
+#include <escher/metric.h>
+#include <ion/display.h>
+#include <string.h>
 
 static mp_obj_t TupleForKDColor(KDColor c) {
   mp_obj_tuple_t * t = static_cast<mp_obj_tuple_t *>(MP_OBJ_TO_PTR(mp_obj_new_tuple(3, NULL)));
@@ -18,7 +22,18 @@ static mp_obj_t TupleForKDColor(KDColor c) {
  * calling kandinsky_get_pixel, kandinsky_set_pixel and kandinsky_draw_string.
  * We do this here with displaySandbox(), which pushes the SandboxController on
  * the stackViewController and forces the window to redraw itself.
- * KDIonContext::sharedContext is set to the frame of the last object drawn. */
+ * KDIonContext::sharedContext is set to the frame of the last object drawn.
+ * Drawings go through OffScreenBuffer::DrawingContext(), which is
+ * KDIonContext::sharedContext unless the script enabled double buffering. */
+
+void modkandinsky_gc_collect() {
+  OffScreenBuffer::sharedBuffer()->collectRoots();
+}
+
+void modkandinsky_deinit() {
+  // The off-screen pixels are gone with the Python heap
+  OffScreenBuffer::sharedBuffer()->reset();
+}
 
 mp_obj_t modkandinsky_color(size_t n_args, const mp_obj_t *args) {
   mp_obj_t color;
@@ -42,7 +57,7 @@ mp_obj_t modkandinsky_color(size_t n_args, const mp_obj_t *args) {
 mp_obj_t modkandinsky_get_pixel(mp_obj_t x, mp_obj_t y) {
   KDPoint point(mp_obj_get_int(x), mp_obj_get_int(y));
   KDColor c;
-  KDIonContext::sharedContext()->getPixel(point, &c);
+  OffScreenBuffer::DrawingContext()->getPixel(point, &c);
   return TupleForKDColor(c);
 }
 
@@ -50,7 +65,7 @@ mp_obj_t modkandinsky_set_pixel(mp_obj_t x, mp_obj_t y, mp_obj_t input) {
   KDPoint point(mp_obj_get_int(x), mp_obj_get_int(y));
   KDColor kdColor = MicroPython::Color::Parse(input);
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
-  KDIonContext::sharedContext()->setPixel(point, kdColor);
+  OffScreenBuffer::DrawingContext()->setPixel(point, kdColor);
   return mp_const_none;
 }
 
@@ -61,7 +76,7 @@ mp_obj_t modkandinsky_draw_string(size_t n_args, const mp_obj_t * args) {
   KDColor textColor = (n_args >= 4) ? MicroPython::Color::Parse(args[3]) : KDColorBlack;
   KDColor backgroundColor = (n_args >= 5) ? MicroPython::Color::Parse(args[4]) : KDColorWhite;
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
-  KDIonContext::sharedContext()->drawString(text, point, KDFont::LargeFont, textColor, backgroundColor);
+  OffScreenBuffer::DrawingContext()->drawString(text, point, KDFont::LargeFont, textColor, backgroundColor);
   return mp_const_none;
 }
 
@@ -81,6 +96,136 @@ mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t * args) {
   KDRect rect(x, y, width, height);
   KDColor color = MicroPython::Color::Parse(args[4]);
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
-  KDIonContext::sharedContext()->fillRect(rect, color);
+  OffScreenBuffer::DrawingContext()->fillRect(rect, color);
+  return mp_const_none;
+}
+
+/* Pixel buffers hold one little-endian RGB565 value per pixel, row after row,
+ * which is the memory layout of KDColor. They are handed over to kandinsky
+ * as is, unless they are not aligned on a KDColor (a memoryview starting on an
+ * odd byte, for instance): those are transferred by small chunks. */
+
+static constexpr int k_pixelChunkLength = 64;
+
+static KDRect RectFromArguments(const mp_obj_t * args, size_t * byteLength) {
+  mp_int_t width = mp_obj_get_int(args[2]);
+  mp_int_t height = mp_obj_get_int(args[3]);
+  if (width < 0 || height < 0 || width > KDCOORDINATE_MAX || height > KDCOORDINATE_MAX) {
+    mp_raise_ValueError("invalid rectangle size");
+  }
+  *byteLength = width * height * sizeof(KDColor);
+  return KDRect(mp_obj_get_int(args[0]), mp_obj_get_int(args[1]), width, height);
+}
+
+static bool IsAlignedOnKDColor(const void * buffer) {
+  return reinterpret_cast<uintptr_t>(buffer) % alignof(KDColor) == 0;
+}
+
+mp_obj_t modkandinsky_draw_pixels(size_t n_args, const mp_obj_t * args) {
+  size_t byteLength;
+  KDRect rect = RectFromArguments(args, &byteLength);
+  mp_buffer_info_t bufferInfo;
+  mp_get_buffer_raise(args[4], &bufferInfo, MP_BUFFER_READ);
+  if (bufferInfo.len != byteLength) {
+    mp_raise_ValueError("buffer size does not match rectangle");
+  }
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  KDContext * context = OffScreenBuffer::DrawingContext();
+  if (IsAlignedOnKDColor(bufferInfo.buf)) {
+    context->fillRectWithPixels(rect, static_cast<const KDColor *>(bufferInfo.buf), nullptr);
+    return mp_const_none;
+  }
+  const uint8_t * source = static_cast<const uint8_t *>(bufferInfo.buf);
+  KDColor chunk[k_pixelChunkLength];
+  for (KDCoordinate j = 0; j < rect.height(); j++) {
+    for (KDCoordinate i = 0; i < rect.width(); i += k_pixelChunkLength) {
+      KDCoordinate chunkLength = rect.width() - i < k_pixelChunkLength ? rect.width() - i : k_pixelChunkLength;
+      memcpy(chunk, source, chunkLength * sizeof(KDColor));
+      source += chunkLength * sizeof(KDColor);
+      context->fillRectWithPixels(KDRect(rect.x() + i, rect.y() + j, chunkLength, 1), chunk, nullptr);
+    }
+  }
+  return mp_const_none;
+}
+
+mp_obj_t modkandinsky_get_pixels(size_t n_args, const mp_obj_t * args) {
+  size_t byteLength;
+  KDRect rect = RectFromArguments(args, &byteLength);
+  mp_obj_t result;
+  uint8_t * destination;
+  if (n_args == 5) {
+    mp_buffer_info_t bufferInfo;
+    mp_get_buffer_raise(args[4], &bufferInfo, MP_BUFFER_WRITE);
+    if (bufferInfo.len != byteLength) {
+      mp_raise_ValueError("buffer size does not match rectangle");
+    }
+    result = args[4];
+    destination = static_cast<uint8_t *>(bufferInfo.buf);
+  } else {
+    destination = m_new(uint8_t, byteLength);
+    result = mp_obj_new_bytearray_by_ref(byteLength, destination);
+  }
+  // Pixels out of the screen are read as black
+  memset(destination, 0, byteLength);
+  KDContext * context = OffScreenBuffer::DrawingContext();
+  if (IsAlignedOnKDColor(destination)) {
+    context->getPixels(rect, reinterpret_cast<KDColor *>(destination));
+    return result;
+  }
+  KDColor chunk[k_pixelChunkLength];
+  for (KDCoordinate j = 0; j < rect.height(); j++) {
+    for (KDCoordinate i = 0; i < rect.width(); i += k_pixelChunkLength) {
+      KDCoordinate chunkLength = rect.width() - i < k_pixelChunkLength ? rect.width() - i : k_pixelChunkLength;
+      for (KDCoordinate k = 0; k < chunkLength; k++) {
+        chunk[k] = KDColorBlack;
+      }
+      context->getPixels(KDRect(rect.x() + i, rect.y() + j, chunkLength, 1), chunk);
+      memcpy(destination, chunk, chunkLength * sizeof(KDColor));
+      destination += chunkLength * sizeof(KDColor);
+    }
+  }
+  return result;
+}
+
+mp_obj_t modkandinsky_set_pixels(mp_obj_t x, mp_obj_t y, mp_obj_t colors) {
+  KDPoint point(mp_obj_get_int(x), mp_obj_get_int(y));
+  /* A run wider than the screen cannot be entirely visible, so the colors are
+   * all parsed before switching to the sandbox. */
+  KDColor pixels[Ion::Display::Width];
+  KDCoordinate length = 0;
+  mp_obj_iter_buf_t iteratorBuffer;
+  mp_obj_t iterator = mp_getiter(colors, &iteratorBuffer);
+  mp_obj_t color;
+  while ((color = mp_iternext(iterator)) != MP_OBJ_STOP_ITERATION) {
+    if (length == Ion::Display::Width) {
+      mp_raise_ValueError("too many colors");
+    }
+    pixels[length++] = MicroPython::Color::Parse(color);
+  }
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  OffScreenBuffer::DrawingContext()->fillRectWithPixels(KDRect(point, length, 1), pixels, nullptr);
+  return mp_const_none;
+}
+
+/* The buffered rectangle has to be given: its pixels take 2 bytes each on the
+ * Python heap, where the whole sandbox, about 140 KB, would not fit. A
+ * rectangle of 100x100 pixels takes 20 KB. */
+mp_obj_t modkandinsky_double_buffer(size_t n_args, const mp_obj_t * args) {
+  OffScreenBuffer * buffer = OffScreenBuffer::sharedBuffer();
+  if (n_args == 1 && !mp_obj_is_true(args[0])) {
+    buffer->disable();
+    return mp_const_none;
+  }
+  if (n_args != 5) {
+    mp_raise_TypeError("double_buffer(True) takes a rectangle: x, y, width and height");
+  }
+  size_t byteLength;
+  KDRect rect = RectFromArguments(args + 1, &byteLength);
+  buffer->enable(rect);
+  return mp_const_none;
+}
+
+mp_obj_t modkandinsky_show() {
+  OffScreenBuffer::sharedBuffer()->show();
   return mp_const_none;
 }
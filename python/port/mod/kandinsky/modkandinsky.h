@@ -1,7 +1,15 @@
 #include <py/obj.h>
 
+void modkandinsky_gc_collect();
+void modkandinsky_deinit();
+
 mp_obj_t modkandinsky_color(size_t n_args, const mp_obj_t *args);
 mp_obj_t modkandinsky_get_pixel(mp_obj_t x, mp_obj_t y);
 mp_obj_t modkandinsky_set_pixel(mp_obj_t x, mp_obj_t y, mp_obj_t color);
 mp_obj_t modkandinsky_draw_string(size_t n_args, const mp_obj_t *args);
 mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t *args);
+mp_obj_t modkandinsky_draw_pixels(size_t n_args, const mp_obj_t *args);
+mp_obj_t modkandinsky_get_pixels(size_t n_args, const mp_obj_t *args);
+mp_obj_t modkandinsky_set_pixels(mp_obj_t x, mp_obj_t y, mp_obj_t colors);
+mp_obj_t modkandinsky_double_buffer(size_t n_args, const mp_obj_t *args);
+mp_obj_t modkandinsky_show();
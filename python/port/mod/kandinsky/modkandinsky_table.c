@@ -5,6 +5,11 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(modkandinsky_get_pixel_obj, modkandinsky_get_pi
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(modkandinsky_set_pixel_obj, modkandinsky_set_pixel);
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modkandinsky_draw_string_obj, 3, 5, modkandinsky_draw_string);
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modkandinsky_fill_rect_obj, 5, 5, modkandinsky_fill_rect);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modkandinsky_draw_pixels_obj, 5, 5, modkandinsky_draw_pixels);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modkandinsky_get_pixels_obj, 4, 5, modkandinsky_get_pixels);
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(modkandinsky_set_pixels_obj, modkandinsky_set_pixels);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modkandinsky_double_buffer_obj, 1, 5, modkandinsky_double_buffer);
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(modkandinsky_show_obj, modkandinsky_show);
 
 STATIC const mp_rom_map_elem_t modkandinsky_module_globals_table[] = {
   { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_kandinsky) },
@@ -13,6 +18,11 @@ STATIC const mp_rom_map_elem_t modkandinsky_module_globals_table[] = {
   { MP_ROM_QSTR(MP_QSTR_set_pixel), (mp_obj_t)&modkandinsky_set_pixel_obj },
   { MP_ROM_QSTR(MP_QSTR_draw_string), (mp_obj_t)&modkandinsky_draw_string_obj },
   { MP_ROM_QSTR(MP_QSTR_fill_rect), (mp_obj_t)&modkandinsky_fill_rect_obj },
+  { MP_ROM_QSTR(MP_QSTR_draw_pixels), (mp_obj_t)&modkandinsky_draw_pixels_obj },
+  { MP_ROM_QSTR(MP_QSTR_get_pixels), (mp_obj_t)&modkandinsky_get_pixels_obj },
+  { MP_ROM_QSTR(MP_QSTR_set_pixels), (mp_obj_t)&modkandinsky_set_pixels_obj },
+  { MP_ROM_QSTR(MP_QSTR_double_buffer), (mp_obj_t)&modkandinsky_double_buffer_obj },
+  { MP_ROM_QSTR(MP_QSTR_show), (mp_obj_t)&modkandinsky_show_obj },
 };
 
 STATIC MP_DEFINE_CONST_DICT(modkandinsky_module_globals, modkandinsky_module_globals_table);
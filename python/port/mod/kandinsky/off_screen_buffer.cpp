@@ -0,0 +1,75 @@
+#include "off_screen_buffer.h"
+extern "C" {
+#include <py/gc.h>
+#include <py/misc.h>
+}
+#include <kandinsky/ion_context.h>
+#include "../../port.h"
+
+OffScreenBuffer * OffScreenBuffer::sharedBuffer() {
+  static OffScreenBuffer buffer;
+  return &buffer;
+}
+
+KDContext * OffScreenBuffer::DrawingContext() {
+  OffScreenBuffer * buffer = sharedBuffer();
+  if (buffer->isEnabled()) {
+    return &buffer->m_context;
+  }
+  return KDIonContext::sharedContext();
+}
+
+void OffScreenBuffer::enable(KDRect rect) {
+  disable();
+  /* The sandbox is displayed first so that the buffer starts from what is
+   * currently on screen, and the screen context is set to the sandbox frame
+   * when the buffer is shown. */
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  KDColor * pixels = m_new(KDColor, rect.width() * rect.height());
+  // Parts of the rect which are out of the screen stay black
+  for (int i = 0; i < rect.width() * rect.height(); i++) {
+    pixels[i] = KDColorBlack;
+  }
+  KDIonContext::sharedContext()->getPixels(rect, pixels);
+  m_pixels = pixels;
+  m_rect = rect;
+  m_dirtyRect = KDRectZero;
+  m_frameBuffer = KDFrameBuffer(m_pixels, rect.size());
+  m_context.setOrigin(KDPoint(-rect.x(), -rect.y()));
+  m_context.setClippingRect(KDRect(KDPointZero, rect.size()));
+}
+
+void OffScreenBuffer::disable() {
+  if (!isEnabled()) {
+    return;
+  }
+  show();
+  m_del(KDColor, m_pixels, m_rect.width() * m_rect.height());
+  m_pixels = nullptr;
+}
+
+void OffScreenBuffer::show() {
+  if (!isEnabled() || m_dirtyRect.isEmpty()) {
+    return;
+  }
+  /* Whole rows are pushed so that the pixels to send are contiguous in the
+   * buffer and go to the display in a single transaction. */
+  KDRect rows(m_rect.x(), m_rect.y() + m_dirtyRect.y(), m_rect.width(), m_dirtyRect.height());
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  KDIonContext::sharedContext()->fillRectWithPixels(rows, m_pixels + m_dirtyRect.y() * m_rect.width(), nullptr);
+  m_dirtyRect = KDRectZero;
+}
+
+void OffScreenBuffer::collectRoots() {
+  MicroPython::collectRootsAtAddress(reinterpret_cast<char *>(&m_pixels), sizeof(m_pixels));
+}
+
+void OffScreenBuffer::Context::pushRect(KDRect rect, const KDColor * pixels) {
+  KDFrameBufferContext::pushRect(rect, pixels);
+  m_buffer->markAsDirty(rect);
+}
+
+void OffScreenBuffer::Context::pushRectUniform(KDRect rect, KDColor color) {
+  KDFrameBufferContext::pushRectUniform(rect, color);
+  m_buffer->markAsDirty(rect);
+}
@@ -0,0 +1,61 @@
+#ifndef PYTHON_PORT_MOD_KANDINSKY_OFF_SCREEN_BUFFER_H
+#define PYTHON_PORT_MOD_KANDINSKY_OFF_SCREEN_BUFFER_H
+
+#include <kandinsky/framebuffer.h>
+#include <kandinsky/framebuffer_context.h>
+
+/* When a script enables double buffering, kandinsky and turtle draw into an
+ * off-screen copy of a rectangle of the sandbox instead of the screen. The
+ * frame is then pushed to the screen at once by show(), which avoids tearing
+ * and turns the many small display transactions of a frame into a single one.
+ *
+ * The pixels are allocated on the Python heap: the object must be registered
+ * as a GC root, and forgotten when the heap is reset. */
+
+class OffScreenBuffer {
+public:
+  static OffScreenBuffer * sharedBuffer();
+  // The context scripts draw into: the off-screen buffer if any, else the screen
+  static KDContext * DrawingContext();
+
+  OffScreenBuffer() :
+    m_pixels(nullptr),
+    m_rect(KDRectZero),
+    m_dirtyRect(KDRectZero),
+    m_frameBuffer(nullptr, KDSizeZero),
+    m_context(this, &m_frameBuffer)
+  {
+  }
+  bool isEnabled() const { return m_pixels != nullptr; }
+  // rect is in sandbox coordinates. May raise a MemoryError.
+  void enable(KDRect rect);
+  void disable();
+  // Push the rows modified since the last call to the screen
+  void show();
+  void reset() { m_pixels = nullptr; }
+  void collectRoots();
+
+private:
+  class Context : public KDFrameBufferContext {
+  public:
+    Context(OffScreenBuffer * buffer, KDFrameBuffer * frameBuffer) :
+      KDFrameBufferContext(frameBuffer),
+      m_buffer(buffer)
+    {
+    }
+  private:
+    void pushRect(KDRect rect, const KDColor * pixels) override;
+    void pushRectUniform(KDRect rect, KDColor color) override;
+    OffScreenBuffer * m_buffer;
+  };
+
+  void markAsDirty(KDRect rect) { m_dirtyRect = m_dirtyRect.unionedWith(rect); }
+
+  KDColor * m_pixels;
+  KDRect m_rect;
+  KDRect m_dirtyRect; // In buffer coordinates
+  KDFrameBuffer m_frameBuffer;
+  Context m_context;
+};
+
+#endif
@@ -1,5 +1,6 @@
 extern "C" {
 #include "modpyplot.h"
+#include <python/port/mod/numarray/modnumarray.h>
 }
 #include <assert.h>
 #include <escher/palette.h>
@@ -18,6 +19,12 @@ static size_t extractArgument(mp_obj_t arg, mp_obj_t ** items) {
   size_t itemLength;
   if (mp_obj_is_type(arg, &mp_type_tuple) || mp_obj_is_type(arg, &mp_type_list)) {
     mp_obj_get_array(arg, &itemLength, items);
+  } else if (numarray_is_array(arg)) {
+    itemLength = numarray_length(arg);
+    *items = m_new(mp_obj_t, itemLength);
+    for (size_t i = 0; i < itemLength; i++) {
+      (*items)[i] = mp_obj_new_float(numarray_float_at(arg, i));
+    }
   } else {
     itemLength = 1;
     *items = m_new(mp_obj_t, 1);
@@ -50,6 +57,21 @@ static size_t extractArgumentAndValidateSize(mp_obj_t arg, size_t requiredlength
   return itemLength;
 }
 
+/* numarray arrays are kept by the store rather than split into boxed floats.
+ * x is None to plot y against its indexes. Return false if the arguments are
+ * not all arrays. */
+
+static bool addSeriesIfArrays(mp_obj_t x, mp_obj_t y, KDColor color, bool isCurve) {
+  if (!numarray_is_array(y) || (x != mp_const_none && !numarray_is_array(x))) {
+    return false;
+  }
+  if (x != mp_const_none && numarray_length(x) != numarray_length(y)) {
+    mp_raise_ValueError("x and y must be the same size");
+  }
+  sPlotStore->addSeries(x, y, color, isCurve);
+  return true;
+}
+
 // Get color from keyword arguments if possible
 
 bool colorFromKeywordArgument(mp_map_elem_t * elemColor, KDColor * color) {
@@ -108,7 +130,7 @@ mp_obj_t modpyplot_arrow(size_t n_args, const mp_obj_t *args, mp_map_t* kw_args)
   elem = mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_head_width), MP_MAP_LOOKUP);
   /* Default head_width is 0.0f because we want a default width in pixel
    * coordinates which is handled by CurveView::drawArrow. */
-  mp_obj_t arrowWidth = (elem == nullptr) ? mp_obj_new_float(0.0f) : elem->value;
+  float arrowWidth = (elem == nullptr) ? 0.0f : mp_obj_get_float(elem->value);
 
   // Setting arrow color
   KDColor color;
@@ -118,7 +140,9 @@ mp_obj_t modpyplot_arrow(size_t n_args, const mp_obj_t *args, mp_map_t* kw_args)
 
   // Adding the object to the plot
   assert(n_args >= 4);
-  sPlotStore->addSegment(args[0], args[1], mp_obj_new_float(mp_obj_get_float(args[0]) + mp_obj_get_float(args[2])), mp_obj_new_float(mp_obj_get_float(args[1]) + mp_obj_get_float(args[3])), color, arrowWidth);
+  float x = mp_obj_get_float(args[0]);
+  float y = mp_obj_get_float(args[1]);
+  sPlotStore->addSegment(x, y, x + mp_obj_get_float(args[2]), y + mp_obj_get_float(args[3]), color, arrowWidth);
   return mp_const_none;
 }
 
@@ -232,12 +256,13 @@ if (n_args > 4) {
 
     float iWf = mp_obj_get_float(iW);
     float iXf = mp_obj_get_float(iX);
-    mp_obj_t rectLeft = mp_obj_new_float(iXf - iWf/2.0f);
-    mp_obj_t rectRight = mp_obj_new_float(iXf + iWf/2.0f);
-    mp_obj_t rectBottom = iB;
-    mp_obj_t rectTop = mp_obj_new_float(mp_obj_get_float(iH) + mp_obj_get_float(iB));
-    if (mp_obj_get_float(iH) < 0.0) {
-      mp_obj_t temp = rectTop;
+    float iHf = mp_obj_get_float(iH);
+    float rectLeft = iXf - iWf/2.0f;
+    float rectRight = iXf + iWf/2.0f;
+    float rectBottom = mp_obj_get_float(iB);
+    float rectTop = iHf + rectBottom;
+    if (iHf < 0.0f) {
+      float temp = rectTop;
       rectTop = rectBottom;
       rectBottom = temp;
     }
@@ -350,7 +375,7 @@ mp_obj_t modpyplot_hist(size_t n_args, const mp_obj_t *args, mp_map_t* kw_args )
   colorFromKeywordArgument(elem, &color);
 
   for (size_t i=0; i<nBins; i++) {
-    sPlotStore->addRect(edgeItems[i], edgeItems[i+1], binItems[i], mp_obj_new_float(0.0), color);
+    sPlotStore->addRect(mp_obj_get_float(edgeItems[i]), mp_obj_get_float(edgeItems[i+1]), MP_OBJ_SMALL_INT_VALUE(binItems[i]), 0.0f, color);
   }
   return mp_const_none;
 }
@@ -366,9 +391,6 @@ mp_obj_t modpyplot_scatter(size_t n_args, const mp_obj_t *args, mp_map_t* kw_arg
     nlr_raise(mp_obj_new_exception_msg_varg(&mp_type_TypeError,"scatter() takes 2 positional arguments but %d were given",n_args));
   }
   sPlotStore->setShow(true);
-  mp_obj_t * xItems, * yItems;
-  assert(n_args >= 2);
-  size_t length = extractArgumentsAndCheckEqualSize(args[0], args[1], &xItems, &yItems);
 
   // Setting scatter color
   // color keyword
@@ -380,9 +402,13 @@ mp_obj_t modpyplot_scatter(size_t n_args, const mp_obj_t *args, mp_map_t* kw_arg
   elem = mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_color), MP_MAP_LOOKUP);
   colorFromKeywordArgument(elem, &color);
 
-  for (size_t i=0; i<length; i++) {
-    sPlotStore->addDot(xItems[i], yItems[i], color);
+  if (addSeriesIfArrays(args[0], args[1], color, false)) {
+    return mp_const_none;
   }
+  mp_obj_t * xItems, * yItems;
+  assert(n_args >= 2);
+  size_t length = extractArgumentsAndCheckEqualSize(args[0], args[1], &xItems, &yItems);
+  sPlotStore->addSeries(length, xItems, yItems, color, false);
 
   return mp_const_none;
 }
@@ -397,21 +423,6 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,mp_map_t* kw_args) {
   if (n_args > 3) {
     nlr_raise(mp_obj_new_exception_msg_varg(&mp_type_TypeError,"plot() takes 3 positional arguments but %d were given",n_args));
   }
-  mp_obj_t * xItems, * yItems;
-  size_t length;
-  if (n_args == 1) {
-    length = extractArgument(args[0], &yItems);
-
-    // Create the default xItems: [0, 1, 2,...]
-    xItems = m_new(mp_obj_t, length);
-    for (size_t i = 0; i < length; i++) {
-      xItems[i] = mp_obj_new_float((float)i);
-    }
-  } else {
-    assert(n_args >= 2);
-    length = extractArgumentsAndCheckEqualSize(args[0], args[1], &xItems, &yItems);
-  }
-
   // Setting plot color
   KDColor color;
   bool isUserSet = false;
@@ -426,9 +437,20 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,mp_map_t* kw_args) {
     color = MicroPython::Color::Parse(args[2]);
   }
 
-  for (int i=0; i<(int)length-1; i++) {
-    sPlotStore->addSegment(xItems[i], yItems[i], xItems[i+1], yItems[i+1], color);
+  if (addSeriesIfArrays(n_args == 1 ? mp_const_none : args[0], n_args == 1 ? args[0] : args[1], color, true)) {
+    return mp_const_none;
+  }
+  mp_obj_t * xItems, * yItems;
+  size_t length;
+  if (n_args == 1) {
+    length = extractArgument(args[0], &yItems);
+    // The default x values are the indexes [0, 1, 2,...]
+    xItems = nullptr;
+  } else {
+    assert(n_args >= 2);
+    length = extractArgumentsAndCheckEqualSize(args[0], args[1], &xItems, &yItems);
   }
+  sPlotStore->addSeries(length, xItems, yItems, color, true);
 
   return mp_const_none;
 }
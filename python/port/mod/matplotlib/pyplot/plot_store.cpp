@@ -1,4 +1,7 @@
 #include "plot_store.h"
+extern "C" {
+#include <python/port/mod/numarray/modnumarray.h>
+}
 #include <algorithm>
 
 namespace Matplotlib {
@@ -10,144 +13,121 @@ PlotStore::PlotStore() : Shared::InteractiveCurveViewRange(),
 }
 
 void PlotStore::flush() {
-  m_dots = mp_obj_new_list(0, nullptr);
-  m_segments = mp_obj_new_list(0, nullptr);
-  m_rects = mp_obj_new_list(0, nullptr);
-  m_labels = mp_obj_new_list(0, nullptr);
+  m_segments.flush();
+  m_rects.flush();
+  m_series.flush();
+  m_labels.flush();
+  m_dataXMin = FLT_MAX;
+  m_dataXMax = -FLT_MAX;
+  m_dataYMin = FLT_MAX;
+  m_dataYMax = -FLT_MAX;
   m_axesRequested = true;
   m_axesAuto = true;
   m_gridRequested = false;
 }
 
-// Iterators
-
-template <class T>
-PlotStore::ListIterator<T> PlotStore::ListIterator<T>::Begin(mp_obj_t list) {
-  ListIterator<T> it;
-  mp_obj_list_get(list, &(it.m_numberOfTuples), &(it.m_tuples));
-  return it;
-}
+// Arena
 
 template <class T>
-PlotStore::ListIterator<T> PlotStore::ListIterator<T>::End(mp_obj_t list) {
-  ListIterator<T> it;
-  mp_obj_list_get(list, &(it.m_numberOfTuples), &(it.m_tuples));
-  if (it.m_numberOfTuples > 0) {
-    it.m_tupleIndex = it.m_numberOfTuples;
-  }
-  return it;
+void PlotStore::Arena<T>::flush() {
+  // The items are freed with the rest of the Python heap
+  m_items = nullptr;
+  m_length = 0;
+  m_capacity = 0;
 }
 
 template <class T>
-PlotStore::ListIterator<T> & PlotStore::ListIterator<T>::operator++() {
-  if (m_tupleIndex < m_numberOfTuples) {
-    m_tupleIndex++;
+T * PlotStore::Arena<T>::push() {
+  if (m_length == m_capacity) {
+    size_t capacity = m_capacity == 0 ? 4 : 2 * m_capacity;
+    m_items = m_renew(T, m_items, m_capacity, capacity);
+    m_capacity = capacity;
   }
-  return *this;
+  return m_items + m_length++;
 }
 
-template <class T>
-bool PlotStore::ListIterator<T>::operator!=(const PlotStore::ListIterator<T> & it) const {
-  return m_tupleIndex != it.m_tupleIndex;
-};
+// Segment
 
-template <class T>
-T PlotStore::ListIterator<T>::operator*() {
-  return T(m_tuples[m_tupleIndex]);
-};
+template class PlotStore::Arena<PlotStore::Segment>;
 
+void PlotStore::addSegment(float xStart, float yStart, float xEnd, float yEnd, KDColor c, float arrowWidth) {
+  *m_segments.push() = Segment(xStart, yStart, xEnd, yEnd, arrowWidth, c);
+  extendDataRange(xStart, yStart);
+  extendDataRange(xEnd, yEnd);
+}
 
-// Dot
+// Rect
 
-template class PlotStore::ListIterator<PlotStore::Dot>;
+template class PlotStore::Arena<PlotStore::Rect>;
 
-PlotStore::Dot::Dot(mp_obj_t tuple) {
-  mp_obj_t * elements;
-  mp_obj_get_array_fixed_n(tuple, 3, &elements);
-  m_x = mp_obj_get_float(elements[0]);
-  m_y = mp_obj_get_float(elements[1]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[2]));
+void PlotStore::addRect(float left, float right, float top, float bottom, KDColor c) {
+  *m_rects.push() = Rect(left, right, top, bottom, c);
+  extendDataRange(left, top);
+  extendDataRange(right, bottom);
 }
 
-void PlotStore::addDot(mp_obj_t x, mp_obj_t y, KDColor c) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[3] = {x, y, color};
-  mp_obj_t tuple = mp_obj_new_tuple(3, items);
-  mp_obj_list_append(m_dots, tuple);
-}
+// Series
 
-// Segment
+template class PlotStore::Arena<PlotStore::Series>;
 
-template class PlotStore::ListIterator<PlotStore::Segment>;
-
-PlotStore::Segment::Segment(mp_obj_t tuple) {
-  mp_obj_t * elements;
-  mp_obj_get_array_fixed_n(tuple, 6 , &elements);
-  m_xStart = mp_obj_get_float(elements[0]);
-  m_yStart = mp_obj_get_float(elements[1]);
-  m_xEnd = mp_obj_get_float(elements[2]);
-  m_yEnd = mp_obj_get_float(elements[3]);
-  m_arrowWidth = mp_obj_get_float(elements[4]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[5]));
+float PlotStore::Series::x(size_t i) const {
+  if (m_points != nullptr) {
+    return m_points[2*i];
+  }
+  return m_x == mp_const_none ? i : numarray_float_at(m_x, i);
 }
 
-void PlotStore::addSegment(mp_obj_t xStart, mp_obj_t yStart, mp_obj_t xEnd, mp_obj_t yEnd, KDColor c, mp_obj_t arrowWidth) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[6] = {xStart, yStart, xEnd, yEnd, arrowWidth, color};
-  mp_obj_t tuple = mp_obj_new_tuple(6, items);
-  mp_obj_list_append(m_segments, tuple);
+float PlotStore::Series::y(size_t i) const {
+  if (m_points != nullptr) {
+    return m_points[2*i+1];
+  }
+  return numarray_float_at(m_y, i);
 }
 
-// Rect
-
-template class PlotStore::ListIterator<PlotStore::Rect>;
-
-PlotStore::Rect::Rect(mp_obj_t tuple) {
-  mp_obj_t * elements;
-  mp_obj_get_array_fixed_n(tuple, 5, &elements);
-  m_left = mp_obj_get_float(elements[0]);
-  m_right = mp_obj_get_float(elements[1]);
-  m_top = mp_obj_get_float(elements[2]);
-  m_bottom = mp_obj_get_float(elements[3]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[4]));
+void PlotStore::addSeries(size_t length, const mp_obj_t * xItems, const mp_obj_t * yItems, KDColor c, bool isCurve) {
+  float * points = m_new(float, 2*length);
+  for (size_t i = 0; i < length; i++) {
+    points[2*i] = xItems == nullptr ? i : mp_obj_get_float(xItems[i]);
+    points[2*i+1] = mp_obj_get_float(yItems[i]);
+  }
+  for (size_t i = 0; i < length; i++) {
+    extendDataRange(points[2*i], points[2*i+1]);
+  }
+  *m_series.push() = Series(points, mp_const_none, mp_const_none, length, c, isCurve);
 }
 
-void PlotStore::addRect(mp_obj_t left, mp_obj_t right, mp_obj_t top, mp_obj_t bottom, KDColor c) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[5] = {left, right, top, bottom, color};
-  mp_obj_t tuple = mp_obj_new_tuple(5, items);
-  mp_obj_list_append(m_rects, tuple);
+void PlotStore::addSeries(mp_obj_t x, mp_obj_t y, KDColor c, bool isCurve) {
+  assert(numarray_is_array(y) && (x == mp_const_none || numarray_length(x) == numarray_length(y)));
+  Series * series = m_series.push();
+  *series = Series(nullptr, x, y, numarray_length(y), c, isCurve);
+  /* The range is the one of the arrays when they are plotted, as they are
+   * only read again to be drawn. */
+  for (size_t i = 0; i < series->length(); i++) {
+    extendDataRange(series->x(i), series->y(i));
+  }
 }
 
 // Label
 
-template class PlotStore::ListIterator<PlotStore::Label>;
-
-PlotStore::Label::Label(mp_obj_t tuple) {
-  mp_obj_t * elements;
-  mp_obj_get_array_fixed_n(tuple, 3, &elements);
-  m_x = mp_obj_get_float(elements[0]);
-  m_y = mp_obj_get_float(elements[1]);
-  m_string = mp_obj_str_get_str(elements[2]);
-}
+template class PlotStore::Arena<PlotStore::Label>;
 
 void PlotStore::addLabel(mp_obj_t x, mp_obj_t y, mp_obj_t string) {
-  mp_obj_t items[3] = {x, y, string};
   if (!mp_obj_is_str(string)) {
     mp_raise_TypeError("argument should be a string");
   }
-  mp_obj_t tuple = mp_obj_new_tuple(3, items);
-  mp_obj_list_append(m_labels, tuple);
+  Label label(mp_obj_get_float(x), mp_obj_get_float(y), string);
+  *m_labels.push() = label;
+  extendDataRange(label.x(), label.y());
 }
 
 // Axes
 
-void updateRange(float * xMin, float * xMax, float * yMin, float * yMax, float x, float y) {
+void PlotStore::extendDataRange(float x, float y) {
   if (!std::isnan(x) && !std::isinf(x) && !std::isnan(y) && !std::isinf(y)) {
-    *xMin = std::min(*xMin, x);
-    *xMax = std::max(*xMax, x);
-    *yMin = std::min(*yMin, y);
-    *yMax = std::max(*yMax, y);
+    m_dataXMin = std::min(m_dataXMin, x);
+    m_dataXMax = std::max(m_dataXMax, x);
+    m_dataYMin = std::min(m_dataYMin, y);
+    m_dataYMax = std::max(m_dataYMax, y);
   }
 }
 
@@ -168,24 +148,10 @@ void checkPositiveRangeAndAddMargin(float * min, float * max) {
 
 void PlotStore::initRange() {
   if (m_axesAuto) {
-    float xMin = FLT_MAX;
-    float xMax = -FLT_MAX;
-    float yMin = FLT_MAX;
-    float yMax = -FLT_MAX;
-    for (PlotStore::Dot dot : dots()) {
-      updateRange(&xMin, &xMax, &yMin, &yMax, dot.x(), dot.y());
-    }
-    for (PlotStore::Label label : labels()) {
-      updateRange(&xMin, &xMax, &yMin, &yMax, label.x(), label.y());
-    }
-    for (PlotStore::Segment segment : segments()) {
-      updateRange(&xMin, &xMax, &yMin, &yMax, segment.xStart(), segment.yStart());
-      updateRange(&xMin, &xMax, &yMin, &yMax, segment.xEnd(), segment.yEnd());
-    }
-    for (PlotStore::Rect rectangle : rects()) {
-      updateRange(&xMin, &xMax, &yMin, &yMax, rectangle.left(), rectangle.top());
-      updateRange(&xMin, &xMax, &yMin, &yMax, rectangle.right(), rectangle.bottom());
-    }
+    float xMin = m_dataXMin;
+    float xMax = m_dataXMax;
+    float yMin = m_dataYMin;
+    float yMax = m_dataYMax;
     checkPositiveRangeAndAddMargin(&xMin, &xMax);
     checkPositiveRangeAndAddMargin(&yMin, &yMax);
     setXMin(xMin);
@@ -14,55 +14,29 @@ public:
   PlotStore();
   void flush();
 
-  // Iterators
+  /* Growable array of packed records allocated in the Python heap. It is
+   * reachable by the garbage collector through the store, which is scanned by
+   * modpyplot_gc_collect. */
 
   template <class T>
-  class ListIterator {
+  class Arena {
   public:
-    static ListIterator Begin(mp_obj_t list);
-    static ListIterator End(mp_obj_t list);
-    T operator*();
-    ListIterator & operator++();
-    bool operator!=(const ListIterator & it) const;
+    void flush();
+    T * push();
+    size_t length() const { return m_length; }
+    const T * begin() const { return m_items; }
+    const T * end() const { return m_items + m_length; }
   private:
-    ListIterator() : m_tupleIndex(0) {}
-    mp_obj_t * m_tuples;
-    size_t m_numberOfTuples;
-    size_t m_tupleIndex;
+    T * m_items;
+    size_t m_length;
+    size_t m_capacity;
   };
 
-  template <class T>
-  class Iterable {
-  public:
-    Iterable(mp_obj_t list) : m_list(list) {}
-    T begin() const { return T::Begin(m_list); }
-    T end() const { return T::End(m_list); }
-  private:
-    mp_obj_t m_list;
-  };
-
-  // Dot
-
-  class Dot {
-  public:
-    Dot(mp_obj_t tuple);
-    float x() const { return m_x; }
-    float y() const { return m_y; }
-    KDColor color() const { return m_color; }
-  private:
-    float m_x;
-    float m_y;
-    KDColor m_color;
-  };
-
-  void addDot(mp_obj_t x, mp_obj_t y, KDColor c);
-  Iterable<ListIterator<Dot>> dots() { return Iterable<ListIterator<Dot>>(m_dots); }
-
   // Segment
 
   class Segment {
   public:
-    Segment(mp_obj_t tuple);
+    Segment(float xStart, float yStart, float xEnd, float yEnd, float arrowWidth, KDColor color) : m_xStart(xStart), m_yStart(yStart), m_xEnd(xEnd), m_yEnd(yEnd), m_arrowWidth(arrowWidth), m_color(color) {}
     float xStart() const { return m_xStart; }
     float yStart() const { return m_yStart; }
     float xEnd() const { return m_xEnd; }
@@ -78,14 +52,14 @@ public:
     KDColor m_color;
   };
 
-  void addSegment(mp_obj_t xStart, mp_obj_t yStart, mp_obj_t xEnd, mp_obj_t yEnd, KDColor c, mp_obj_t arrowWidth = mp_obj_new_float(NAN));
-  Iterable<ListIterator<Segment>> segments() { return Iterable<ListIterator<Segment>>(m_segments); }
+  void addSegment(float xStart, float yStart, float xEnd, float yEnd, KDColor c, float arrowWidth = NAN);
+  const Arena<Segment> & segments() const { return m_segments; }
 
   // Rect
 
   class Rect {
   public:
-    Rect(mp_obj_t tuple);
+    Rect(float left, float right, float top, float bottom, KDColor color) : m_left(left), m_right(right), m_top(top), m_bottom(bottom), m_color(color) {}
     float left() const { return m_left; }
     float right() const { return m_right; }
     float top() const { return m_top; }
@@ -99,25 +73,52 @@ public:
     KDColor m_color;
   };
 
-  void addRect(mp_obj_t x, mp_obj_t y, mp_obj_t width, mp_obj_t height, KDColor c);
-  Iterable<ListIterator<Rect>> rects() { return Iterable<ListIterator<Rect>>(m_rects); }
+  void addRect(float left, float right, float top, float bottom, KDColor c);
+  const Arena<Rect> & rects() const { return m_rects; }
+
+  // Series
+
+  /* Curve or scatter. Points given as lists are unboxed once into a packed
+   * array of (x, y) floats. numarray arrays are referenced instead, and
+   * without x array the x values are the indexes of y. */
+  class Series {
+  public:
+    Series(const float * points, mp_obj_t x, mp_obj_t y, size_t length, KDColor color, bool isCurve) : m_points(points), m_x(x), m_y(y), m_length(length), m_color(color), m_isCurve(isCurve) {}
+    size_t length() const { return m_length; }
+    float x(size_t i) const;
+    float y(size_t i) const;
+    bool isCurve() const { return m_isCurve; }
+    KDColor color() const { return m_color; }
+  private:
+    const float * m_points;
+    mp_obj_t m_x;
+    mp_obj_t m_y;
+    size_t m_length;
+    KDColor m_color;
+    bool m_isCurve;
+  };
+
+  // xItems is nullptr to use the indexes of yItems
+  void addSeries(size_t length, const mp_obj_t * xItems, const mp_obj_t * yItems, KDColor c, bool isCurve);
+  void addSeries(mp_obj_t x, mp_obj_t y, KDColor c, bool isCurve);
+  const Arena<Series> & series() const { return m_series; }
 
   // Label
 
   class Label {
   public:
-    Label(mp_obj_t tuple);
+    Label(float x, float y, mp_obj_t string) : m_x(x), m_y(y), m_string(string) {}
     float x() const { return m_x; }
     float y() const { return m_y; }
-    const char * string() const { return m_string; }
+    const char * string() const { return mp_obj_str_get_str(m_string); }
   private:
     float m_x;
     float m_y;
-    const char * m_string;
+    mp_obj_t m_string;
   };
 
   void addLabel(mp_obj_t x, mp_obj_t y, mp_obj_t string);
-  Iterable<ListIterator<Label>> labels() { return Iterable<ListIterator<Label>>(m_labels); }
+  const Arena<Label> & labels() const { return m_labels; }
 
   void setAxesRequested(bool b) { m_axesRequested = b; }
   bool axesRequested() const { return m_axesRequested; }
@@ -129,10 +130,16 @@ public:
   void setGridRequested(bool b) { m_gridRequested = b; }
   bool gridRequested() const { return m_gridRequested; }
 private:
-  mp_obj_t m_dots; // List of (x, y, color)
-  mp_obj_t m_labels; // List of (x, y, string)
-  mp_obj_t m_segments; // List of (x, y, dx, dy, style, color)
-  mp_obj_t m_rects; // List of (x, y, w, h, color)
+  void extendDataRange(float x, float y);
+  Arena<Segment> m_segments;
+  Arena<Rect> m_rects;
+  Arena<Series> m_series;
+  Arena<Label> m_labels;
+  // Bounding box of the data, extended by each added figure
+  float m_dataXMin;
+  float m_dataXMax;
+  float m_dataYMin;
+  float m_dataYMax;
   bool m_axesRequested;
   bool m_axesAuto;
   bool m_gridRequested;
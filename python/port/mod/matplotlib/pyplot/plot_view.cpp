@@ -23,29 +23,25 @@ void PlotView::drawRect(KDContext * ctx, KDRect rect) const {
    * to catch any errors. */
   nlr_buf_t nlr;
   if (nlr_push(&nlr) == 0) {
-    for (PlotStore::Dot dot : m_store->dots()) {
-      traceDot(ctx, rect, dot);
-    }
-    for (PlotStore::Label label : m_store->labels()) {
+    for (const PlotStore::Label & label : m_store->labels()) {
       traceLabel(ctx, rect, label);
     }
-    for (PlotStore::Segment segment : m_store->segments()) {
+    for (const PlotStore::Segment & segment : m_store->segments()) {
       traceSegment(ctx, rect, segment);
     }
-    for (PlotStore::Rect rectangle : m_store->rects()) {
+    for (const PlotStore::Rect & rectangle : m_store->rects()) {
       traceRect(ctx, rect, rectangle);
     }
+    for (const PlotStore::Series & series : m_store->series()) {
+      traceSeries(ctx, rect, series);
+    }
     nlr_pop();
   } else { // Uncaught exception
     MicroPython::ExecutionEnvironment::HandleException(&nlr, m_micropythonEnvironment);
   }
 }
 
-void PlotView::traceDot(KDContext * ctx, KDRect r, PlotStore::Dot dot) const {
-  drawDot(ctx, r, dot.x(), dot.y(), dot.color());
-}
-
-void PlotView::traceSegment(KDContext * ctx, KDRect r, PlotStore::Segment segment) const {
+void PlotView::traceSegment(KDContext * ctx, KDRect r, const PlotStore::Segment & segment) const {
   drawSegment(
     ctx, r,
     segment.xStart(), segment.yStart(),
@@ -59,7 +55,7 @@ void PlotView::traceSegment(KDContext * ctx, KDRect r, PlotStore::Segment segmen
   }
 }
 
-void PlotView::traceRect(KDContext * ctx, KDRect r, PlotStore::Rect rect) const {
+void PlotView::traceRect(KDContext * ctx, KDRect r, const PlotStore::Rect & rect) const {
   KDCoordinate left = std::round(floatToPixel(Axis::Horizontal, rect.left()));
   KDCoordinate right = std::round(floatToPixel(Axis::Horizontal, rect.right()));
   KDCoordinate top = std::round(floatToPixel(Axis::Vertical, rect.top()));
@@ -73,7 +69,7 @@ void PlotView::traceRect(KDContext * ctx, KDRect r, PlotStore::Rect rect) const
   ctx->fillRect(pixelRect, rect.color());
 }
 
-void PlotView::traceLabel(KDContext * ctx, KDRect r, PlotStore::Label label) const {
+void PlotView::traceLabel(KDContext * ctx, KDRect r, const PlotStore::Label & label) const {
   drawLabel(ctx, r,
     label.x(), label.y(), label.string(),
     KDColorBlack,
@@ -82,4 +78,87 @@ void PlotView::traceLabel(KDContext * ctx, KDRect r, PlotStore::Label label) con
   );
 }
 
+/* Series can have many more points than there are pixel columns. Consecutive
+ * points falling on the same pixel are drawn once, and consecutive points of a
+ * curve falling in the same column are drawn as a vertical span from their
+ * minimal to their maximal ordinate. */
+
+static bool isFinite(float x, float y) {
+  return !std::isnan(x) && !std::isinf(x) && !std::isnan(y) && !std::isinf(y);
+}
+
+/* Pixel coordinates are only compared, so values out of the KDCoordinate range
+ * are clamped before the cast, which would be undefined otherwise. This
+ * includes NaN, which floatToPixel returns for an empty range. */
+static KDCoordinate clampedPixel(float p) {
+  if (std::isnan(p)) {
+    return KDCOORDINATE_MAX;
+  }
+  return std::round(std::max(static_cast<float>(KDCOORDINATE_MIN), std::min(p, static_cast<float>(KDCOORDINATE_MAX))));
+}
+
+void PlotView::traceSeries(KDContext * ctx, KDRect r, const PlotStore::Series & series) const {
+  KDColor color = series.color();
+  if (!series.isCurve()) {
+    KDCoordinate previousColumn = KDCOORDINATE_MAX;
+    KDCoordinate previousRow = KDCOORDINATE_MAX;
+    for (size_t i = 0; i < series.length(); i++) {
+      float x = series.x(i);
+      float y = series.y(i);
+      if (!isFinite(x, y)) {
+        continue;
+      }
+      KDCoordinate column = clampedPixel(floatToPixel(Axis::Horizontal, x));
+      KDCoordinate row = clampedPixel(floatToPixel(Axis::Vertical, y));
+      if (column != previousColumn || row != previousRow) {
+        drawDot(ctx, r, x, y, color);
+        previousColumn = column;
+        previousRow = row;
+      }
+    }
+    return;
+  }
+  // Last point of the current column, which the next column is joined to
+  bool hasPrevious = false;
+  float previousX = NAN;
+  float previousY = NAN;
+  KDCoordinate previousColumn = 0;
+  // Ordinates span of the current column
+  float spanMin = NAN;
+  float spanMax = NAN;
+  for (size_t i = 0; i < series.length(); i++) {
+    float x = series.x(i);
+    float y = series.y(i);
+    if (!isFinite(x, y)) {
+      // Points which cannot be drawn break the curve
+      if (hasPrevious && spanMin < spanMax) {
+        drawSegment(ctx, r, previousX, spanMin, previousX, spanMax, color);
+      }
+      hasPrevious = false;
+      continue;
+    }
+    KDCoordinate column = clampedPixel(floatToPixel(Axis::Horizontal, x));
+    if (hasPrevious && column == previousColumn) {
+      spanMin = std::min(spanMin, y);
+      spanMax = std::max(spanMax, y);
+    } else {
+      if (hasPrevious) {
+        if (spanMin < spanMax) {
+          drawSegment(ctx, r, previousX, spanMin, previousX, spanMax, color);
+        }
+        drawSegment(ctx, r, previousX, previousY, x, y, color);
+      }
+      spanMin = y;
+      spanMax = y;
+      previousColumn = column;
+      hasPrevious = true;
+    }
+    previousX = x;
+    previousY = y;
+  }
+  if (hasPrevious && spanMin < spanMax) {
+    drawSegment(ctx, r, previousX, spanMin, previousX, spanMax, color);
+  }
+}
+
 }
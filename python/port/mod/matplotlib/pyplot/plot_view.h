@@ -16,10 +16,10 @@ public:
   void drawRect(KDContext * ctx, KDRect rect) const override;
   void setMicroPythonExecutionEnvironment(MicroPython::ExecutionEnvironment * env) { m_micropythonEnvironment = env; }
 private:
-  void traceDot(KDContext * ctx, KDRect r, PlotStore::Dot dot) const;
-  void traceSegment(KDContext * ctx, KDRect r, PlotStore::Segment segment) const;
-  void traceRect(KDContext * ctx, KDRect r, PlotStore::Rect rect) const;
-  void traceLabel(KDContext * ctx, KDRect r, PlotStore::Label label) const;
+  void traceSegment(KDContext * ctx, KDRect r, const PlotStore::Segment & segment) const;
+  void traceRect(KDContext * ctx, KDRect r, const PlotStore::Rect & rect) const;
+  void traceLabel(KDContext * ctx, KDRect r, const PlotStore::Label & label) const;
+  void traceSeries(KDContext * ctx, KDRect r, const PlotStore::Series & series) const;
   PlotStore * m_store;
   MicroPython::ExecutionEnvironment * m_micropythonEnvironment;
 };
@@ -0,0 +1,589 @@
+extern "C" {
+#include "modnumarray.h"
+#include <py/builtin.h>
+#include <py/runtime.h>
+}
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+/* Arrays are contiguous buffers of a single type of number, which scripts can
+ * process as a whole. A list of n floats takes n pointers plus n boxed floats
+ * of 16 bytes on the heap, and every operation on its items goes through the
+ * bytecode loop, whereas an array of float32 takes 4n bytes and is processed
+ * by native loops.
+ *
+ * Operations compute in double precision for floating point results and in
+ * 64-bit integers otherwise. The results are then stored with the type of the
+ * array: overflowing integers wrap around as in C. */
+
+// Private helpers
+
+static size_t itemSize(char dtype) {
+  switch (dtype) {
+    case 'f':
+      return sizeof(float);
+    case 'd':
+      return sizeof(double);
+    case 'h':
+      return sizeof(int16_t);
+    default:
+      assert(dtype == 'i');
+      return sizeof(int32_t);
+  }
+}
+
+static bool isFloatType(char dtype) {
+  return dtype == 'f' || dtype == 'd';
+}
+
+static const char * dtypeName(char dtype) {
+  switch (dtype) {
+    case 'f':
+      return "float32";
+    case 'd':
+      return "float64";
+    case 'h':
+      return "int16";
+    default:
+      return "int32";
+  }
+}
+
+static char dtypeFromObject(mp_obj_t dtype) {
+  mp_int_t code = mp_obj_get_int(dtype);
+  if (code != 'f' && code != 'd' && code != 'h' && code != 'i') {
+    mp_raise_ValueError("invalid dtype");
+  }
+  return code;
+}
+
+static char dtypeFromKeywordArgument(mp_map_t * kw_args, char defaultType) {
+  mp_map_elem_t * elem = mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_dtype), MP_MAP_LOOKUP);
+  return elem == nullptr ? defaultType : dtypeFromObject(elem->value);
+}
+
+static numarray_obj_t * newArray(char dtype, size_t length) {
+  numarray_obj_t * array = m_new_obj(numarray_obj_t);
+  array->base.type = &numarray_type;
+  array->dtype = dtype;
+  array->length = length;
+  /* Items are allocated apart from the object as GC blocks are aligned on
+   * their size, which suits any item type. */
+  array->items = length == 0 ? nullptr : m_new(byte, length * itemSize(dtype));
+  return array;
+}
+
+static numarray_obj_t * arrayFromObject(mp_obj_t o) {
+  if (!mp_obj_is_type(o, &numarray_type)) {
+    mp_raise_TypeError("array expected");
+  }
+  return static_cast<numarray_obj_t *>(MP_OBJ_TO_PTR(o));
+}
+
+static inline double floatAt(const numarray_obj_t * array, size_t i) {
+  switch (array->dtype) {
+    case 'f':
+      return static_cast<const float *>(array->items)[i];
+    case 'd':
+      return static_cast<const double *>(array->items)[i];
+    case 'h':
+      return static_cast<const int16_t *>(array->items)[i];
+    default:
+      return static_cast<const int32_t *>(array->items)[i];
+  }
+}
+
+static inline int64_t integerAt(const numarray_obj_t * array, size_t i) {
+  assert(!isFloatType(array->dtype));
+  if (array->dtype == 'h') {
+    return static_cast<const int16_t *>(array->items)[i];
+  }
+  return static_cast<const int32_t *>(array->items)[i];
+}
+
+static inline void setIntegerAt(numarray_obj_t * array, size_t i, int64_t value) {
+  switch (array->dtype) {
+    case 'f':
+      static_cast<float *>(array->items)[i] = value;
+      return;
+    case 'd':
+      static_cast<double *>(array->items)[i] = value;
+      return;
+    case 'h':
+      static_cast<int16_t *>(array->items)[i] = static_cast<uint16_t>(value);
+      return;
+    default:
+      static_cast<int32_t *>(array->items)[i] = static_cast<uint32_t>(value);
+  }
+}
+
+static inline void setFloatAt(numarray_obj_t * array, size_t i, double value) {
+  if (array->dtype == 'f') {
+    static_cast<float *>(array->items)[i] = value;
+  } else if (array->dtype == 'd') {
+    static_cast<double *>(array->items)[i] = value;
+  } else {
+    // Converting a float out of the range of the integer type is undefined
+    if (!(value > INT32_MIN && value < INT32_MAX)) {
+      value = isnan(value) ? 0 : (value > 0 ? INT32_MAX : INT32_MIN);
+    }
+    setIntegerAt(array, i, static_cast<int64_t>(value));
+  }
+}
+
+static mp_obj_t objectAt(const numarray_obj_t * array, size_t i) {
+  if (isFloatType(array->dtype)) {
+    return mp_obj_new_float(floatAt(array, i));
+  }
+  return mp_obj_new_int(integerAt(array, i));
+}
+
+static void setObjectAt(numarray_obj_t * array, size_t i, mp_obj_t value) {
+  if (mp_obj_is_int(value)) {
+    setIntegerAt(array, i, mp_obj_get_int_truncated(value));
+  } else {
+    setFloatAt(array, i, mp_obj_get_float(value));
+  }
+}
+
+static numarray_obj_t * arrayFromIterable(mp_obj_t iterable, char dtype) {
+  if (mp_obj_is_type(iterable, &numarray_type)) {
+    numarray_obj_t * source = static_cast<numarray_obj_t *>(MP_OBJ_TO_PTR(iterable));
+    numarray_obj_t * array = newArray(dtype, source->length);
+    for (size_t i = 0; i < source->length; i++) {
+      setFloatAt(array, i, floatAt(source, i));
+    }
+    return array;
+  }
+  if (mp_obj_is_type(iterable, &mp_type_list) || mp_obj_is_type(iterable, &mp_type_tuple)) {
+    size_t length;
+    mp_obj_t * items;
+    mp_obj_get_array(iterable, &length, &items);
+    numarray_obj_t * array = newArray(dtype, length);
+    for (size_t i = 0; i < length; i++) {
+      setObjectAt(array, i, items[i]);
+    }
+    return array;
+  }
+  // Other iterables are first gathered in a list as their length is unknown
+  return arrayFromIterable(mp_type_list.make_new(&mp_type_list, 1, 0, &iterable), dtype);
+}
+
+// Operands of arithmetic operations: an array or a scalar
+
+struct Operand {
+  const numarray_obj_t * array;
+  double floatValue;
+  int64_t integerValue;
+  bool isFloat;
+};
+
+static bool operandFromObject(mp_obj_t o, Operand * operand) {
+  operand->array = nullptr;
+  if (mp_obj_is_type(o, &numarray_type)) {
+    operand->array = static_cast<const numarray_obj_t *>(MP_OBJ_TO_PTR(o));
+    operand->isFloat = isFloatType(operand->array->dtype);
+  } else if (mp_obj_is_int(o)) {
+    operand->integerValue = mp_obj_get_int_truncated(o);
+    operand->floatValue = operand->integerValue;
+    operand->isFloat = false;
+  } else if (mp_obj_is_float(o)) {
+    operand->floatValue = mp_obj_get_float(o);
+    operand->isFloat = true;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+static inline double floatOperandAt(const Operand & operand, size_t i) {
+  return operand.array == nullptr ? operand.floatValue : floatAt(operand.array, i);
+}
+
+static inline int64_t integerOperandAt(const Operand & operand, size_t i) {
+  return operand.array == nullptr ? operand.integerValue : integerAt(operand.array, i);
+}
+
+static bool hasType(const Operand & operand, char dtype) {
+  return operand.array != nullptr && operand.array->dtype == dtype;
+}
+
+static char resultType(const Operand & a, const Operand & b, mp_binary_op_t op) {
+  if (a.isFloat || b.isFloat || op == MP_BINARY_OP_TRUE_DIVIDE) {
+    return hasType(a, 'd') || hasType(b, 'd') ? 'd' : 'f';
+  }
+  return hasType(a, 'i') || hasType(b, 'i') ? 'i' : 'h';
+}
+
+static void compute(mp_binary_op_t op, numarray_obj_t * result, const Operand & a, const Operand & b) {
+  size_t length = result->length;
+  if (a.isFloat || b.isFloat || op == MP_BINARY_OP_TRUE_DIVIDE || op == MP_BINARY_OP_POWER) {
+    for (size_t i = 0; i < length; i++) {
+      double x = floatOperandAt(a, i);
+      double y = floatOperandAt(b, i);
+      double r;
+      switch (op) {
+        case MP_BINARY_OP_ADD:
+          r = x + y;
+          break;
+        case MP_BINARY_OP_SUBTRACT:
+          r = x - y;
+          break;
+        case MP_BINARY_OP_MULTIPLY:
+          r = x * y;
+          break;
+        case MP_BINARY_OP_TRUE_DIVIDE:
+          r = x / y;
+          break;
+        default:
+          assert(op == MP_BINARY_OP_POWER);
+          r = pow(x, y);
+      }
+      setFloatAt(result, i, r);
+    }
+    return;
+  }
+  for (size_t i = 0; i < length; i++) {
+    /* Unsigned arithmetic wraps around instead of overflowing, the result is
+     * truncated to the type of the array anyway. */
+    uint64_t x = integerOperandAt(a, i);
+    uint64_t y = integerOperandAt(b, i);
+    uint64_t r;
+    switch (op) {
+      case MP_BINARY_OP_ADD:
+        r = x + y;
+        break;
+      case MP_BINARY_OP_SUBTRACT:
+        r = x - y;
+        break;
+      default:
+        assert(op == MP_BINARY_OP_MULTIPLY);
+        r = x * y;
+    }
+    setIntegerAt(result, i, r);
+  }
+}
+
+// Accessors
+
+bool numarray_is_array(mp_obj_t o) {
+  return mp_obj_is_type(o, &numarray_type);
+}
+
+size_t numarray_length(mp_obj_t o) {
+  return arrayFromObject(o)->length;
+}
+
+mp_float_t numarray_float_at(mp_obj_t o, size_t index) {
+  return floatAt(static_cast<numarray_obj_t *>(MP_OBJ_TO_PTR(o)), index);
+}
+
+// Type
+
+/* array(iterable, dtype=float32)
+ * Float32 is the default type: it halves the memory of float64 and is as
+ * precise as what plots and the screen can show. */
+
+mp_obj_t numarray_make_new(const mp_obj_type_t * type, size_t n_args, size_t n_kw, const mp_obj_t * args) {
+  mp_arg_check_num(n_args, n_kw, 1, 2, true);
+  mp_map_t kw_args;
+  mp_map_init_fixed_table(&kw_args, n_kw, args + n_args);
+  char dtype = n_args == 2 ? dtypeFromObject(args[1]) : dtypeFromKeywordArgument(&kw_args, 'f');
+  return MP_OBJ_FROM_PTR(arrayFromIterable(args[0], dtype));
+}
+
+void numarray_print(const mp_print_t * print, mp_obj_t self_in, mp_print_kind_t kind) {
+  // Long arrays are elided as they would flood the console
+  constexpr size_t k_maxNumberOfPrintedItems = 10;
+  constexpr size_t k_numberOfItemsAroundEllipsis = 3;
+  numarray_obj_t * self = static_cast<numarray_obj_t *>(MP_OBJ_TO_PTR(self_in));
+  mp_print_str(print, "array([");
+  for (size_t i = 0; i < self->length; i++) {
+    if (self->length > k_maxNumberOfPrintedItems && i == k_numberOfItemsAroundEllipsis) {
+      mp_print_str(print, ", ...");
+      i = self->length - k_numberOfItemsAroundEllipsis;
+    }
+    if (i > 0) {
+      mp_print_str(print, ", ");
+    }
+    mp_obj_print_helper(print, objectAt(self, i), PRINT_REPR);
+  }
+  mp_printf(print, "], dtype=%s)", dtypeName(self->dtype));
+}
+
+mp_obj_t numarray_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+  numarray_obj_t * self = static_cast<numarray_obj_t *>(MP_OBJ_TO_PTR(self_in));
+  switch (op) {
+    case MP_UNARY_OP_BOOL:
+      return mp_obj_new_bool(self->length != 0);
+    case MP_UNARY_OP_LEN:
+      return MP_OBJ_NEW_SMALL_INT(self->length);
+    case MP_UNARY_OP_POSITIVE:
+      return self_in;
+    case MP_UNARY_OP_NEGATIVE:
+    case MP_UNARY_OP_ABS:
+    {
+      numarray_obj_t * result = newArray(self->dtype, self->length);
+      for (size_t i = 0; i < self->length; i++) {
+        if (isFloatType(self->dtype)) {
+          double x = floatAt(self, i);
+          setFloatAt(result, i, op == MP_UNARY_OP_ABS ? fabs(x) : -x);
+        } else {
+          int64_t x = integerAt(self, i);
+          setIntegerAt(result, i, op == MP_UNARY_OP_ABS && x >= 0 ? x : -x);
+        }
+      }
+      return MP_OBJ_FROM_PTR(result);
+    }
+    default:
+      return MP_OBJ_NULL;
+  }
+}
+
+mp_obj_t numarray_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+  bool inPlace = false;
+  if (op >= MP_BINARY_OP_INPLACE_OR && op <= MP_BINARY_OP_INPLACE_POWER) {
+    op = static_cast<mp_binary_op_t>(op + MP_BINARY_OP_OR - MP_BINARY_OP_INPLACE_OR);
+    inPlace = true;
+  }
+  if (op != MP_BINARY_OP_ADD && op != MP_BINARY_OP_SUBTRACT && op != MP_BINARY_OP_MULTIPLY && op != MP_BINARY_OP_TRUE_DIVIDE && op != MP_BINARY_OP_POWER) {
+    return MP_OBJ_NULL;
+  }
+  Operand a, b;
+  if (!operandFromObject(lhs, &a) || !operandFromObject(rhs, &b)) {
+    return MP_OBJ_NULL;
+  }
+  size_t length = a.array ? a.array->length : b.array->length;
+  if (a.array && b.array && a.array->length != b.array->length) {
+    mp_raise_ValueError("arrays must be the same size");
+  }
+  numarray_obj_t * result;
+  if (inPlace) {
+    // The target of an augmented assignment is lhs, it keeps its type
+    result = static_cast<numarray_obj_t *>(MP_OBJ_TO_PTR(lhs));
+  } else {
+    result = newArray(resultType(a, b, op), length);
+  }
+  compute(op, result, a, b);
+  return MP_OBJ_FROM_PTR(result);
+}
+
+mp_obj_t numarray_reverse_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+  // Augmented assignments would store into lhs, which is not an array
+  if (op < MP_BINARY_OP_OR || op > MP_BINARY_OP_POWER || !numarray_is_array(rhs)) {
+    return MP_OBJ_NULL;
+  }
+  return numarray_binary_op(op, lhs, rhs);
+}
+
+mp_obj_t numarray_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value) {
+  numarray_obj_t * self = static_cast<numarray_obj_t *>(MP_OBJ_TO_PTR(self_in));
+  if (value == MP_OBJ_NULL) {
+    // Deletion
+    return MP_OBJ_NULL;
+  }
+  if (mp_obj_is_type(index, &mp_type_slice)) {
+    mp_bound_slice_t slice;
+    if (value != MP_OBJ_SENTINEL || !mp_seq_get_fast_slice_indexes(self->length, index, &slice)) {
+      mp_raise_NotImplementedError(nullptr);
+    }
+    size_t size = itemSize(self->dtype);
+    numarray_obj_t * result = newArray(self->dtype, slice.stop - slice.start);
+    memcpy(result->items, static_cast<byte *>(self->items) + slice.start * size, result->length * size);
+    return MP_OBJ_FROM_PTR(result);
+  }
+  size_t i = mp_get_index(self->base.type, self->length, index, false);
+  if (value == MP_OBJ_SENTINEL) {
+    return objectAt(self, i);
+  }
+  setObjectAt(self, i, value);
+  return mp_const_none;
+}
+
+typedef struct _numarray_iterator_t {
+  mp_obj_base_t base;
+  mp_fun_1_t iternext;
+  mp_obj_t array;
+  size_t index;
+} numarray_iterator_t;
+
+static mp_obj_t numarray_iternext(mp_obj_t self_in) {
+  numarray_iterator_t * self = static_cast<numarray_iterator_t *>(MP_OBJ_TO_PTR(self_in));
+  numarray_obj_t * array = static_cast<numarray_obj_t *>(MP_OBJ_TO_PTR(self->array));
+  if (self->index >= array->length) {
+    return MP_OBJ_STOP_ITERATION;
+  }
+  return objectAt(array, self->index++);
+}
+
+mp_obj_t numarray_getiter(mp_obj_t self_in, mp_obj_iter_buf_t * iter_buf) {
+  static_assert(sizeof(numarray_iterator_t) <= sizeof(mp_obj_iter_buf_t), "The iterator does not fit in iter_buf");
+  numarray_iterator_t * iterator = reinterpret_cast<numarray_iterator_t *>(iter_buf);
+  iterator->base.type = &mp_type_polymorph_iter;
+  iterator->iternext = numarray_iternext;
+  iterator->array = self_in;
+  iterator->index = 0;
+  return MP_OBJ_FROM_PTR(iterator);
+}
+
+mp_int_t numarray_get_buffer(mp_obj_t self_in, mp_buffer_info_t * bufinfo, mp_uint_t flags) {
+  numarray_obj_t * self = static_cast<numarray_obj_t *>(MP_OBJ_TO_PTR(self_in));
+  bufinfo->buf = self->items;
+  bufinfo->len = self->length * itemSize(self->dtype);
+  bufinfo->typecode = self->dtype;
+  return 0;
+}
+
+// Reductions
+
+mp_obj_t numarray_sum(mp_obj_t self_in) {
+  numarray_obj_t * self = arrayFromObject(self_in);
+  if (isFloatType(self->dtype)) {
+    double sum = 0.0;
+    for (size_t i = 0; i < self->length; i++) {
+      sum += floatAt(self, i);
+    }
+    return mp_obj_new_float(sum);
+  }
+  int64_t sum = 0;
+  for (size_t i = 0; i < self->length; i++) {
+    sum += integerAt(self, i);
+  }
+  return mp_obj_new_int_from_ll(sum);
+}
+
+static mp_obj_t extremum(mp_obj_t self_in, bool max) {
+  numarray_obj_t * self = arrayFromObject(self_in);
+  if (self->length == 0) {
+    mp_raise_ValueError("empty array");
+  }
+  size_t result = 0;
+  double resultValue = floatAt(self, 0);
+  for (size_t i = 1; i < self->length; i++) {
+    double value = floatAt(self, i);
+    // NAN is never selected, unless it is the first item
+    if (max ? value > resultValue : value < resultValue) {
+      result = i;
+      resultValue = value;
+    }
+  }
+  return objectAt(self, result);
+}
+
+mp_obj_t numarray_min(mp_obj_t self_in) {
+  return extremum(self_in, false);
+}
+
+mp_obj_t numarray_max(mp_obj_t self_in) {
+  return extremum(self_in, true);
+}
+
+mp_obj_t numarray_mean(mp_obj_t self_in) {
+  numarray_obj_t * self = arrayFromObject(self_in);
+  if (self->length == 0) {
+    mp_raise_ValueError("empty array");
+  }
+  return mp_obj_new_float(mp_obj_get_float(numarray_sum(self_in)) / self->length);
+}
+
+/* The module functions shadow the builtins under "from numarray import *", so
+ * they fall back to them for anything but a single array. */
+
+mp_obj_t modnumarray_sum(size_t n_args, const mp_obj_t * args) {
+  if (n_args == 1 && numarray_is_array(args[0])) {
+    return numarray_sum(args[0]);
+  }
+  return mp_builtin_sum_obj.fun.var(n_args, args);
+}
+
+mp_obj_t modnumarray_min(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args) {
+  if (n_args == 1 && kw_args->used == 0 && numarray_is_array(args[0])) {
+    return numarray_min(args[0]);
+  }
+  return mp_builtin_min_obj.fun.kw(n_args, args, kw_args);
+}
+
+mp_obj_t modnumarray_max(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args) {
+  if (n_args == 1 && kw_args->used == 0 && numarray_is_array(args[0])) {
+    return numarray_max(args[0]);
+  }
+  return mp_builtin_max_obj.fun.kw(n_args, args, kw_args);
+}
+
+mp_obj_t numarray_tolist(mp_obj_t self_in) {
+  numarray_obj_t * self = arrayFromObject(self_in);
+  mp_obj_t list = mp_obj_new_list(self->length, nullptr);
+  mp_obj_t * items;
+  size_t length;
+  mp_obj_list_get(list, &length, &items);
+  for (size_t i = 0; i < length; i++) {
+    items[i] = objectAt(self, i);
+  }
+  return list;
+}
+
+// Module functions
+
+// zeros(n, dtype=float32)
+
+mp_obj_t modnumarray_zeros(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args) {
+  mp_int_t length = mp_obj_get_int(args[0]);
+  if (length < 0) {
+    mp_raise_ValueError("negative size");
+  }
+  numarray_obj_t * array = newArray(dtypeFromKeywordArgument(kw_args, 'f'), length);
+  memset(array->items, 0, length * itemSize(array->dtype));
+  return MP_OBJ_FROM_PTR(array);
+}
+
+// linspace(start, stop, num=50, dtype=float32): num evenly spaced values from start to stop included
+
+mp_obj_t modnumarray_linspace(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args) {
+  mp_float_t start = mp_obj_get_float(args[0]);
+  mp_float_t stop = mp_obj_get_float(args[1]);
+  mp_int_t num = 50;
+  if (n_args > 2) {
+    num = mp_obj_get_int(args[2]);
+  } else {
+    mp_map_elem_t * elem = mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_num), MP_MAP_LOOKUP);
+    if (elem != nullptr) {
+      num = mp_obj_get_int(elem->value);
+    }
+  }
+  if (num < 0) {
+    mp_raise_ValueError("negative size");
+  }
+  numarray_obj_t * array = newArray(dtypeFromKeywordArgument(kw_args, 'f'), num);
+  mp_float_t step = num > 1 ? (stop - start) / (num - 1) : 0.0;
+  for (mp_int_t i = 0; i < num; i++) {
+    // Computing each value from start avoids accumulating rounding errors
+    setFloatAt(array, i, i == num - 1 ? stop : start + i * step);
+  }
+  return MP_OBJ_FROM_PTR(array);
+}
+
+/* arange(stop), arange(start, stop[, step], dtype)
+ * Values from start included to stop excluded. The default type is int32 if
+ * all the bounds are integers, float32 otherwise. */
+
+mp_obj_t modnumarray_arange(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args) {
+  if (n_args > 3) {
+    mp_raise_TypeError("arange() takes at most 3 positional arguments");
+  }
+  mp_obj_t start = n_args > 1 ? args[0] : MP_OBJ_NEW_SMALL_INT(0);
+  mp_obj_t stop = n_args > 1 ? args[1] : args[0];
+  mp_obj_t step = n_args > 2 ? args[2] : MP_OBJ_NEW_SMALL_INT(1);
+  bool integers = mp_obj_is_int(start) && mp_obj_is_int(stop) && mp_obj_is_int(step);
+  mp_float_t startValue = mp_obj_get_float(start);
+  mp_float_t stepValue = mp_obj_get_float(step);
+  if (stepValue == 0.0) {
+    mp_raise_ValueError("step must not be zero");
+  }
+  mp_float_t length = ceil((mp_obj_get_float(stop) - startValue) / stepValue);
+  numarray_obj_t * array = newArray(dtypeFromKeywordArgument(kw_args, integers ? 'i' : 'f'), length > 0 ? static_cast<size_t>(length) : 0);
+  for (size_t i = 0; i < array->length; i++) {
+    setFloatAt(array, i, startValue + i * stepValue);
+  }
+  return MP_OBJ_FROM_PTR(array);
+}
@@ -0,0 +1,41 @@
+#include <py/obj.h>
+
+/* Typed contiguous arrays of numbers. The items are stored unboxed, with the
+ * same type codes as MicroPython's buffer protocol. */
+
+typedef struct _numarray_obj_t {
+  mp_obj_base_t base;
+  char dtype; // 'f', 'd', 'h' or 'i'
+  size_t length;
+  void * items;
+} numarray_obj_t;
+
+extern const mp_obj_type_t numarray_type;
+
+// Accessors for the other modules
+bool numarray_is_array(mp_obj_t o);
+size_t numarray_length(mp_obj_t o);
+mp_float_t numarray_float_at(mp_obj_t o, size_t index);
+
+mp_obj_t numarray_make_new(const mp_obj_type_t * type, size_t n_args, size_t n_kw, const mp_obj_t * args);
+void numarray_print(const mp_print_t * print, mp_obj_t self_in, mp_print_kind_t kind);
+mp_obj_t numarray_unary_op(mp_unary_op_t op, mp_obj_t self_in);
+mp_obj_t numarray_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs);
+// Operations whose only array is the right operand, as in 2 * a
+mp_obj_t numarray_reverse_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs);
+mp_obj_t numarray_subscr(mp_obj_t self_in, mp_obj_t index, mp_obj_t value);
+mp_obj_t numarray_getiter(mp_obj_t self_in, mp_obj_iter_buf_t * iter_buf);
+mp_int_t numarray_get_buffer(mp_obj_t self_in, mp_buffer_info_t * bufinfo, mp_uint_t flags);
+
+mp_obj_t numarray_sum(mp_obj_t self_in);
+mp_obj_t numarray_min(mp_obj_t self_in);
+mp_obj_t numarray_max(mp_obj_t self_in);
+mp_obj_t numarray_mean(mp_obj_t self_in);
+mp_obj_t numarray_tolist(mp_obj_t self_in);
+
+mp_obj_t modnumarray_sum(size_t n_args, const mp_obj_t * args);
+mp_obj_t modnumarray_min(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args);
+mp_obj_t modnumarray_max(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args);
+mp_obj_t modnumarray_zeros(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args);
+mp_obj_t modnumarray_linspace(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args);
+mp_obj_t modnumarray_arange(size_t n_args, const mp_obj_t * args, mp_map_t * kw_args);
@@ -0,0 +1,60 @@
+#include "modnumarray.h"
+
+MP_DEFINE_CONST_FUN_OBJ_1(numarray_sum_obj, numarray_sum);
+MP_DEFINE_CONST_FUN_OBJ_1(numarray_min_obj, numarray_min);
+MP_DEFINE_CONST_FUN_OBJ_1(numarray_max_obj, numarray_max);
+MP_DEFINE_CONST_FUN_OBJ_1(numarray_mean_obj, numarray_mean);
+MP_DEFINE_CONST_FUN_OBJ_1(numarray_tolist_obj, numarray_tolist);
+
+STATIC const mp_rom_map_elem_t numarray_locals_dict_table[] = {
+  { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&numarray_sum_obj) },
+  { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&numarray_min_obj) },
+  { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&numarray_max_obj) },
+  { MP_ROM_QSTR(MP_QSTR_mean), MP_ROM_PTR(&numarray_mean_obj) },
+  { MP_ROM_QSTR(MP_QSTR_tolist), MP_ROM_PTR(&numarray_tolist_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(numarray_locals_dict, numarray_locals_dict_table);
+
+const mp_obj_type_t numarray_type = {
+  { &mp_type_type },
+  .name = MP_QSTR_array,
+  .print = numarray_print,
+  .make_new = numarray_make_new,
+  .unary_op = numarray_unary_op,
+  .binary_op = numarray_binary_op,
+  .subscr = numarray_subscr,
+  .getiter = numarray_getiter,
+  .buffer_p = { .get_buffer = numarray_get_buffer },
+  .locals_dict = (mp_obj_dict_t*)&numarray_locals_dict,
+};
+
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modnumarray_sum_obj, 1, 2, modnumarray_sum);
+MP_DEFINE_CONST_FUN_OBJ_KW(modnumarray_min_obj, 1, modnumarray_min);
+MP_DEFINE_CONST_FUN_OBJ_KW(modnumarray_max_obj, 1, modnumarray_max);
+MP_DEFINE_CONST_FUN_OBJ_KW(modnumarray_zeros_obj, 1, modnumarray_zeros);
+MP_DEFINE_CONST_FUN_OBJ_KW(modnumarray_linspace_obj, 2, modnumarray_linspace);
+MP_DEFINE_CONST_FUN_OBJ_KW(modnumarray_arange_obj, 1, modnumarray_arange);
+
+STATIC const mp_rom_map_elem_t modnumarray_module_globals_table[] = {
+  { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_numarray) },
+  { MP_ROM_QSTR(MP_QSTR_array), MP_ROM_PTR(&numarray_type) },
+  { MP_ROM_QSTR(MP_QSTR_zeros), MP_ROM_PTR(&modnumarray_zeros_obj) },
+  { MP_ROM_QSTR(MP_QSTR_linspace), MP_ROM_PTR(&modnumarray_linspace_obj) },
+  { MP_ROM_QSTR(MP_QSTR_arange), MP_ROM_PTR(&modnumarray_arange_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&modnumarray_sum_obj) },
+  { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&modnumarray_min_obj) },
+  { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&modnumarray_max_obj) },
+  { MP_ROM_QSTR(MP_QSTR_mean), MP_ROM_PTR(&numarray_mean_obj) },
+  { MP_ROM_QSTR(MP_QSTR_float32), MP_ROM_INT('f') },
+  { MP_ROM_QSTR(MP_QSTR_float64), MP_ROM_INT('d') },
+  { MP_ROM_QSTR(MP_QSTR_int16), MP_ROM_INT('h') },
+  { MP_ROM_QSTR(MP_QSTR_int32), MP_ROM_INT('i') },
+};
+
+STATIC MP_DEFINE_CONST_DICT(modnumarray_module_globals, modnumarray_module_globals_table);
+
+const mp_obj_module_t modnumarray_module = {
+  .base = { &mp_type_module },
+  .globals = (mp_obj_dict_t*)&modnumarray_module_globals,
+};
@@ -0,0 +1,39 @@
+extern "C" {
+#include "modprofiler.h"
+#include <py/runtime.h>
+}
+#include "profiler.h"
+
+/* start() clears the previous samples and starts profiling. The report is
+ * printed by stop(), or when the console command running the script returns
+ * if the profiler is still running then. */
+
+mp_obj_t modprofiler_start() {
+  MicroPython::Profiler::start();
+  return mp_const_none;
+}
+
+mp_obj_t modprofiler_stop() {
+  if (MicroPython::Profiler::isRunning()) {
+    MicroPython::Profiler::stop();
+    MicroPython::Profiler::printReport();
+  }
+  return mp_const_none;
+}
+
+// Return a list of (function, line, ms) tuples sorted by decreasing time
+mp_obj_t modprofiler_stats() {
+  int numberOfLocations;
+  uint32_t overflowTime;
+  const MicroPython::Profiler::Location * locations = MicroPython::Profiler::locations(&numberOfLocations, &overflowTime);
+  mp_obj_t stats = mp_obj_new_list(0, nullptr);
+  for (int i = 0; i < numberOfLocations; i++) {
+    mp_obj_t items[3] = {
+      MP_OBJ_NEW_QSTR(locations[i].function),
+      MP_OBJ_NEW_SMALL_INT(locations[i].line),
+      mp_obj_new_int(locations[i].time)
+    };
+    mp_obj_list_append(stats, mp_obj_new_tuple(3, items));
+  }
+  return stats;
+}
@@ -0,0 +1,5 @@
+#include <py/obj.h>
+
+mp_obj_t modprofiler_start();
+mp_obj_t modprofiler_stop();
+mp_obj_t modprofiler_stats();
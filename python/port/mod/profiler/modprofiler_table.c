@@ -0,0 +1,19 @@
+#include "modprofiler.h"
+
+MP_DEFINE_CONST_FUN_OBJ_0(modprofiler_start_obj, modprofiler_start);
+MP_DEFINE_CONST_FUN_OBJ_0(modprofiler_stop_obj, modprofiler_stop);
+MP_DEFINE_CONST_FUN_OBJ_0(modprofiler_stats_obj, modprofiler_stats);
+
+STATIC const mp_rom_map_elem_t modprofiler_module_globals_table[] = {
+  { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_profiler) },
+  { MP_ROM_QSTR(MP_QSTR_start), MP_ROM_PTR(&modprofiler_start_obj) },
+  { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&modprofiler_stop_obj) },
+  { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&modprofiler_stats_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(modprofiler_module_globals, modprofiler_module_globals_table);
+
+const mp_obj_module_t modprofiler_module = {
+  .base = { &mp_type_module },
+  .globals = (mp_obj_dict_t*)&modprofiler_module_globals,
+};
@@ -99,6 +99,23 @@ mp_obj_t modturtle_speed(size_t n_args, const mp_obj_t *args) {
   return mp_const_none;
 }
 
+mp_obj_t modturtle_tracer(size_t n_args, const mp_obj_t *args) {
+  if (n_args == 0) {
+    return MP_OBJ_NEW_SMALL_INT(sTurtle.tracer());
+  }
+  mp_int_t n = mp_obj_get_int(args[0]);
+  if (n < 0 || n > UINT16_MAX) {
+    mp_raise_ValueError("tracer() argument out of range");
+  }
+  sTurtle.setTracer(n);
+  return mp_const_none;
+}
+
+mp_obj_t modturtle_update() {
+  sTurtle.update();
+  return mp_const_none;
+}
+
 mp_obj_t modturtle_position() {
   mp_obj_t mp_pos[2];
   mp_pos[0] = mp_obj_new_float(sTurtle.x());
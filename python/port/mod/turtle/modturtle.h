@@ -14,6 +14,8 @@ mp_obj_t modturtle_circle(size_t n_args, const mp_obj_t *args);
 mp_obj_t modturtle_goto(size_t n_args, const mp_obj_t *args);
 mp_obj_t modturtle_setheading(mp_obj_t deg);
 mp_obj_t modturtle_speed(size_t n_args, const mp_obj_t *args);
+mp_obj_t modturtle_tracer(size_t n_args, const mp_obj_t *args);
+mp_obj_t modturtle_update();
 
 mp_obj_t modturtle_position();
 mp_obj_t modturtle_heading();
@@ -1,12 +1,14 @@
 #include "turtle.h"
 #include <escher/palette.h>
-#include <kandinsky/ion_context.h>
+#include <kandinsky/pixel_run.h>
 #include <cmath>
+#include <string.h>
 extern "C" {
 #include <py/misc.h>
 }
 #include "../../helpers.h"
 #include "../../port.h"
+#include "../kandinsky/off_screen_buffer.h"
 
 static inline mp_float_t absF(mp_float_t x) { return x >= 0 ? x : -x;}
 
@@ -39,9 +41,10 @@ void Turtle::reset() {
   m_speed = k_defaultSpeed;
   m_penSize = k_defaultPenSize;
   m_mileage = 0;
+  m_numberOfDeferredDrawings = 0;
 
   // Draw the turtle
-  draw(true);
+  refresh();
 }
 
 bool Turtle::forward(mp_float_t length) {
@@ -91,46 +94,18 @@ void Turtle::circle(mp_int_t radius, mp_float_t angle) {
 }
 
 bool Turtle::goTo(mp_float_t x, mp_float_t y) {
-  mp_float_t oldx = m_x;
-  mp_float_t oldy = m_y;
-  mp_float_t xLength = absF(std::floor(x) - std::floor(oldx));
-  mp_float_t yLength = absF(std::floor(y) - std::floor(oldy));
-
-  enum PrincipalDirection {
-    None = 0,
-    X = 1,
-    Y = 2
-  };
-
-  PrincipalDirection principalDirection = xLength > yLength ?
-    PrincipalDirection::X :
-    (xLength == yLength ?
-     PrincipalDirection::None :
-     PrincipalDirection::Y);
-
-  mp_float_t length = principalDirection == PrincipalDirection::X ? xLength : yLength;
-
-  if (length > 1) {
-    // Tweening function
-    for (int i = 1; i < length; i++) {
-      mp_float_t progress = i / length;
-      erase();
-      /* We make sure that each pixel along the principal direction is drawn. If
-       * the computation of the position on the principal coordinate is done
-       * using a barycenter, roundings might skip some pixels, which results in
-       * a dotted line. */
-      mp_float_t currentX = xLength == 0 ? x : (principalDirection == PrincipalDirection::Y ? x * progress + oldx * (1 - progress) : oldx + (x > oldx ? i : -i));
-      mp_float_t currentY = yLength == 0 ? y : (principalDirection == PrincipalDirection::X ? y * progress + oldy * (1 - progress) : oldy + (y > oldy ? i : -i));
-      if (dot(currentX, currentY) || draw(false)) {
-        // Keyboard interruption. Return now to let MicroPython process it.
-        return true;
-      }
-    }
+  if (m_tracer != 1 && deferLine(x, y)) {
+    m_x = x;
+    m_y = y;
+    refresh();
+    return micropython_port_vm_hook_loop();
   }
-
-  erase();
-  dot(x, y);
-  draw(true);
+  // At speed(0), or when the screen is not updated at each move, the turtle does not walk
+  if (drawLine(x, y, m_speed > 0 && m_tracer == 1)) {
+    // Keyboard interruption. Return now to let MicroPython process it.
+    return true;
+  }
+  refresh();
   return false;
 }
 
@@ -138,7 +113,7 @@ void Turtle::setHeading(mp_float_t angle) {
   micropython_port_vm_hook_loop();
   setHeadingPrivate(angle);
   erase();
-  draw(true);
+  refresh();
 }
 
 void Turtle::setSpeed(mp_int_t speed) {
@@ -170,28 +145,41 @@ void Turtle::setPenSize(KDCoordinate penSize) {
 void Turtle::setVisible(bool visible) {
   m_visible = visible;
   if (m_visible) {
-    draw(true);
+    refresh();
   } else {
     erase();
   }
 }
 
 void Turtle::write(const char * string) {
-  // We erase the turtle to redraw it on top of the text
   if (isOutOfBounds()) {
     return;
   }
+  if (m_tracer != 1 && deferText(string)) {
+    refresh();
+    return;
+  }
+  // We erase the turtle to redraw it on top of the text
   erase();
-  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
-  KDContext * ctx = KDIonContext::sharedContext();
-  static constexpr KDCoordinate headOffsetLength = 6;
-  KDCoordinate headOffsetX = headOffsetLength * std::cos(m_heading * k_headingScale);
-  KDCoordinate headOffsetY = k_invertedYAxisCoefficient * headOffsetLength * std::sin(m_heading * k_headingScale);
-  KDPoint headOffset(headOffsetX, headOffsetY);
-  KDPoint head(-k_iconHeadSize, -k_iconHeadSize);
-  KDPoint stringOffset = KDPoint(0,-k_font->glyphSize().height());
-  ctx->drawString(string, position().translatedBy(headOffset).translatedBy(head).translatedBy(stringOffset));
+  drawText(string);
+  refresh();
+}
+
+void Turtle::setTracer(uint16_t n) {
+  m_tracer = n;
+  m_pendingUpdates = 0;
+  if (n == 1) {
+    // Show what has been drawn so far
+    update();
+  }
+}
+
+void Turtle::update() {
+  m_pendingUpdates = 0;
+  erase();
+  drawDeferredDrawings();
   draw(true);
+  OffScreenBuffer::sharedBuffer()->show();
 }
 
 
@@ -199,12 +187,60 @@ void Turtle::viewDidDisappear() {
   m_drawn = false;
 }
 
-bool Turtle::isOutOfBounds() const {
-  return absF(x()) > k_maxPosition || absF(y()) > k_maxPosition;
-};
-
 // Private functions
 
+Turtle::LineDots::LineDots(mp_float_t fromX, mp_float_t fromY, mp_float_t toX, mp_float_t toY) :
+  m_fromX(fromX),
+  m_fromY(fromY),
+  m_toX(toX),
+  m_toY(toY)
+{
+  mp_float_t xLength = absF(std::floor(toX) - std::floor(fromX));
+  mp_float_t yLength = absF(std::floor(toY) - std::floor(fromY));
+  m_principalDirection = xLength > yLength ?
+    PrincipalDirection::X :
+    (xLength == yLength ?
+     PrincipalDirection::None :
+     PrincipalDirection::Y);
+  mp_float_t length = m_principalDirection == PrincipalDirection::X ? xLength : yLength;
+  m_numberOfDots = length > 1 ? length : 1;
+  m_sameColumn = xLength == 0;
+  m_sameRow = yLength == 0;
+}
+
+/* We make sure that each pixel along the principal direction is drawn. If the
+ * computation of the position on the principal coordinate is done using a
+ * barycenter, roundings might skip some pixels, which results in a dotted
+ * line. */
+
+mp_float_t Turtle::LineDots::x(int i) const {
+  assert(i >= 1 && i <= m_numberOfDots);
+  if (i == m_numberOfDots || m_sameColumn) {
+    return m_toX;
+  }
+  if (m_principalDirection == PrincipalDirection::Y) {
+    mp_float_t progress = static_cast<mp_float_t>(i) / m_numberOfDots;
+    return m_toX * progress + m_fromX * (1 - progress);
+  }
+  return m_fromX + (m_toX > m_fromX ? i : -i);
+}
+
+mp_float_t Turtle::LineDots::y(int i) const {
+  assert(i >= 1 && i <= m_numberOfDots);
+  if (i == m_numberOfDots || m_sameRow) {
+    return m_toY;
+  }
+  if (m_principalDirection == PrincipalDirection::X) {
+    mp_float_t progress = static_cast<mp_float_t>(i) / m_numberOfDots;
+    return m_toY * progress + m_fromY * (1 - progress);
+  }
+  return m_fromY + (m_toY > m_fromY ? i : -i);
+}
+
+bool Turtle::isOutOfBounds(mp_float_t x, mp_float_t y) const {
+  return absF(x) > k_maxPosition || absF(y) > k_maxPosition;
+}
+
 void Turtle::setHeadingPrivate(mp_float_t angle) {
   // Put the angle in [0; 360[
   mp_float_t angleLimit = 360;
@@ -272,10 +308,11 @@ bool Turtle::draw(bool force) {
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
 
   if ((m_speed > 0 || force) && m_visible && !m_drawn && hasUnderneathPixelBuffer() && !isOutOfBounds()) {
-    KDContext * ctx = KDIonContext::sharedContext();
+    KDContext * ctx = OffScreenBuffer::DrawingContext();
 
     // Get the pixels underneath the turtle
-    ctx->getPixels(iconRect(), m_underneathPixelBuffer);
+    m_iconRect = iconRect();
+    ctx->getPixels(m_iconRect, m_underneathPixelBuffer);
 
     // Draw the body
     KDRect drawingRect = KDRect(
@@ -349,32 +386,228 @@ bool Turtle::draw(bool force) {
   return false;
 }
 
-bool Turtle::dot(mp_float_t x, mp_float_t y) {
+void Turtle::dot(mp_float_t x, mp_float_t y) {
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
 
   // Draw the dot if the pen is down
   if (m_penDown && hasDotBuffers() && !isOutOfBounds()) {
-    KDContext * ctx = KDIonContext::sharedContext();
-    KDRect rect(
-      position(x, y).translatedBy(KDPoint(-m_penSize/2, -m_penSize/2)),
-      KDSize(m_penSize, m_penSize)
-    );
+    KDContext * ctx = OffScreenBuffer::DrawingContext();
+    KDRect rect(dotOrigin(x, y), KDSize(m_penSize, m_penSize));
     ctx->blendRectWithMask(rect, m_color, m_dotMask, m_dotWorkingPixelBuffer);
   }
 
-  /* Increase the turtle's mileage. We need to make sure the mileage is not
-   * overflowed, otherwise we might skip some msleeps in draw. */
-  uint16_t additionalMileage = sqrt((x - m_x) * (x - m_x) + (y - m_y) * (y - m_y)) * 1000;
-  m_mileage = ((m_mileage > k_mileageLimit)
-      && ((m_mileage + additionalMileage) < k_mileageLimit)) ?
-    k_mileageLimit + 1 : m_mileage + additionalMileage;
-
+  increaseMileage(sqrt((x - m_x) * (x - m_x) + (y - m_y) * (y - m_y)));
   m_x = x;
   m_y = y;
+}
+
+void Turtle::blendLine(const LineDots & dots) {
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  if (!m_penDown || m_penSize <= 0 || !hasDotMask()) {
+    return;
+  }
+  KDContext * ctx = OffScreenBuffer::DrawingContext();
+  KDColor pixels[Ion::Display::Width];
+  // Origins of the dots of a chunk
+  KDCoordinate dotsX[k_lineChunkSize];
+  KDCoordinate dotsY[k_lineChunkSize];
+  int numberOfDots = dots.numberOfDots();
+  /* The dots are blended by chunks, row by row: each row crossed by a chunk
+   * is read and written once, whatever the number of dots crossing it.
+   * Blending the dots in the order they are drawn in gives the same pixels as
+   * stamping them one by one. */
+  for (int chunkStart = 1; chunkStart <= numberOfDots; chunkStart += k_lineChunkSize) {
+    int chunkEnd = chunkStart + k_lineChunkSize > numberOfDots + 1 ? numberOfDots + 1 : chunkStart + k_lineChunkSize;
+    int numberOfOrigins = 0;
+    for (int i = chunkStart; i < chunkEnd; i++) {
+      mp_float_t x = dots.x(i);
+      mp_float_t y = dots.y(i);
+      if (isOutOfBounds(x, y)) {
+        continue;
+      }
+      KDPoint origin = dotOrigin(x, y);
+      dotsX[numberOfOrigins] = origin.x();
+      dotsY[numberOfOrigins] = origin.y();
+      numberOfOrigins++;
+    }
+    if (numberOfOrigins == 0) {
+      continue;
+    }
+    /* The rows of the dots go up or down with their number: the dots crossing
+     * a row are the k-th ones for k in [kBegin, kEnd[. */
+    bool downwards = dotsY[0] <= dotsY[numberOfOrigins - 1];
+    KDCoordinate top = dotsY[downwards ? 0 : numberOfOrigins - 1];
+    KDCoordinate bottom = dotsY[downwards ? numberOfOrigins - 1 : 0] + m_penSize;
+    bottom = bottom > Ion::Display::Height ? Ion::Display::Height : bottom;
+    int kBegin = downwards ? 0 : numberOfOrigins;
+    int kEnd = kBegin;
+    for (KDCoordinate row = top < 0 ? 0 : top; row < bottom; row++) {
+      if (downwards) {
+        while (kEnd < numberOfOrigins && dotsY[kEnd] <= row) {
+          kEnd++;
+        }
+        while (kBegin < kEnd && dotsY[kBegin] + m_penSize <= row) {
+          kBegin++;
+        }
+      } else {
+        while (kBegin > 0 && dotsY[kBegin - 1] <= row) {
+          kBegin--;
+        }
+        while (kEnd > kBegin && dotsY[kEnd - 1] + m_penSize <= row) {
+          kEnd--;
+        }
+      }
+      KDCoordinate left = Ion::Display::Width;
+      KDCoordinate right = 0;
+      for (int k = kBegin; k < kEnd; k++) {
+        left = dotsX[k] < left ? dotsX[k] : left;
+        right = dotsX[k] + m_penSize > right ? dotsX[k] + m_penSize : right;
+      }
+      left = left < 0 ? 0 : left;
+      right = right > Ion::Display::Width ? Ion::Display::Width : right;
+      if (left >= right) {
+        continue;
+      }
+      KDRect run(left, row, right - left, 1);
+      ctx->getPixels(run, pixels);
+      for (int k = kBegin; k < kEnd; k++) {
+        KDCoordinate from = dotsX[k] < left ? left : dotsX[k];
+        KDCoordinate to = dotsX[k] + m_penSize > right ? right : dotsX[k] + m_penSize;
+        if (from < to) {
+          KDPixelRun::BlendWithMask(pixels + (from - left), m_color, m_dotMask + (row - dotsY[k]) * m_penSize + (from - dotsX[k]), to - from);
+        }
+      }
+      ctx->fillRectWithPixels(run, pixels, nullptr);
+    }
+  }
+}
 
+void Turtle::increaseMileage(mp_float_t length) {
+  /* The mileage must not overflow, otherwise we might skip some msleeps in
+   * draw. Past the limit, draw sleeps once whatever the mileage. */
+  mp_float_t mileage = m_mileage + length * 1000;
+  m_mileage = mileage > k_mileageLimit ? k_mileageLimit + 1 : mileage;
+}
+
+bool Turtle::drawLine(mp_float_t x, mp_float_t y, bool walk) {
+  LineDots dots(m_x, m_y, x, y);
+  erase();
+  if (walk) {
+    for (int i = 1; i < dots.numberOfDots(); i++) {
+      dot(dots.x(i), dots.y(i));
+      if (draw(false)) {
+        return true;
+      }
+      erase();
+    }
+    dot(x, y);
+  } else {
+    blendLine(dots);
+    increaseMileage(sqrt((x - m_x) * (x - m_x) + (y - m_y) * (y - m_y)));
+    m_x = x;
+    m_y = y;
+  }
+  // The interruptions are checked once per line
   return micropython_port_vm_hook_loop();
 }
 
+bool Turtle::drawDeferredDrawings() {
+  // The drawings are done with the state of the turtle they were recorded with
+  mp_float_t x = m_x;
+  mp_float_t y = m_y;
+  mp_float_t heading = m_heading;
+  KDColor color = m_color;
+  KDCoordinate penSize = m_penSize;
+  bool penDown = m_penDown;
+  int numberOfDeferredDrawings = m_numberOfDeferredDrawings;
+  m_numberOfDeferredDrawings = 0;
+  m_penDown = true;
+  bool interrupted = false;
+  for (int i = 0; i < numberOfDeferredDrawings && !interrupted; i++) {
+    const DeferredDrawing & drawing = m_deferredDrawings[i];
+    m_x = drawing.x;
+    m_y = drawing.y;
+    m_heading = drawing.heading;
+    m_color = drawing.color;
+    setPenSize(drawing.penSize);
+    if (drawing.text != nullptr) {
+      drawText(drawing.text);
+    } else {
+      interrupted = drawLine(drawing.toX, drawing.toY, false);
+    }
+  }
+  m_x = x;
+  m_y = y;
+  m_heading = heading;
+  m_color = color;
+  setPenSize(penSize);
+  m_penDown = penDown;
+  return interrupted;
+}
+
+void Turtle::drawText(const char * string) {
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  KDContext * ctx = OffScreenBuffer::DrawingContext();
+  static constexpr KDCoordinate headOffsetLength = 6;
+  KDCoordinate headOffsetX = headOffsetLength * std::cos(m_heading * k_headingScale);
+  KDCoordinate headOffsetY = k_invertedYAxisCoefficient * headOffsetLength * std::sin(m_heading * k_headingScale);
+  KDPoint headOffset(headOffsetX, headOffsetY);
+  KDPoint head(-k_iconHeadSize, -k_iconHeadSize);
+  KDPoint stringOffset = KDPoint(0,-k_font->glyphSize().height());
+  ctx->drawString(string, position().translatedBy(headOffset).translatedBy(head).translatedBy(stringOffset));
+}
+
+void Turtle::refresh() {
+  if (m_tracer == 1) {
+    draw(true);
+    return;
+  }
+  if (m_tracer > 0 && ++m_pendingUpdates >= m_tracer) {
+    update();
+  }
+}
+
+bool Turtle::deferLine(mp_float_t x, mp_float_t y) {
+  if (!m_penDown) {
+    // Moving with the pen up draws nothing
+    return true;
+  }
+  return deferDrawing({nullptr, static_cast<float>(m_x), static_cast<float>(m_y), static_cast<float>(x), static_cast<float>(y), static_cast<float>(m_heading), m_color, m_penSize});
+}
+
+bool Turtle::deferText(const char * string) {
+  size_t length = strlen(string);
+  char * text = m_new_maybe(char, length + 1);
+  if (text == nullptr) {
+    flushDeferredDrawings();
+    return false;
+  }
+  memcpy(text, string, length + 1);
+  return deferDrawing({text, static_cast<float>(m_x), static_cast<float>(m_y), 0.0f, 0.0f, static_cast<float>(m_heading), m_color, m_penSize});
+}
+
+bool Turtle::deferDrawing(const DeferredDrawing & drawing) {
+  if (m_deferredDrawings == nullptr) {
+    m_deferredDrawings = m_new_maybe(DeferredDrawing, k_maxNumberOfDeferredDrawings);
+    if (m_deferredDrawings == nullptr) {
+      flushDeferredDrawings();
+      return false;
+    }
+  }
+  if (m_numberOfDeferredDrawings == k_maxNumberOfDeferredDrawings) {
+    // The drawings are bounded so as not to fill the heap: draw them earlier
+    update();
+  }
+  m_deferredDrawings[m_numberOfDeferredDrawings++] = drawing;
+  return true;
+}
+
+void Turtle::flushDeferredDrawings() {
+  // The drawing which could not be recorded is drawn over the recorded ones
+  erase();
+  drawDeferredDrawings();
+}
+
 void Turtle::drawPaw(PawType type, PawPosition pos) {
   assert(!m_drawn);
   assert(m_underneathPixelBuffer != nullptr);
@@ -397,14 +630,14 @@ void Turtle::drawPaw(PawType type, PawPosition pos) {
       position().translatedBy(offset), // The paw is too small to need to offset it from its center
       k_iconPawSize,
       k_iconPawSize);
-  KDIonContext::sharedContext()->fillRect(drawingRect, m_color);
+  OffScreenBuffer::DrawingContext()->fillRect(drawingRect, m_color);
 }
 
 void Turtle::erase() {
-  if (!m_drawn || m_underneathPixelBuffer == nullptr || isOutOfBounds()) {
+  if (!m_drawn || m_underneathPixelBuffer == nullptr) {
     return;
   }
-  KDContext * ctx = KDIonContext::sharedContext();
-  ctx->fillRectWithPixels(iconRect(), m_underneathPixelBuffer, nullptr);
+  KDContext * ctx = OffScreenBuffer::DrawingContext();
+  ctx->fillRectWithPixels(m_iconRect, m_underneathPixelBuffer, nullptr);
   m_drawn = false;
 }
@@ -25,6 +25,7 @@ public:
     m_underneathPixelBuffer(nullptr),
     m_dotMask(nullptr),
     m_dotWorkingPixelBuffer(nullptr),
+    m_deferredDrawings(nullptr),
     m_x(0),
     m_y(0),
     m_heading(0),
@@ -35,6 +36,10 @@ public:
     m_speed(k_defaultSpeed),
     m_penSize(k_defaultPenSize),
     m_mileage(0),
+    m_tracer(1),
+    m_pendingUpdates(0),
+    m_numberOfDeferredDrawings(0),
+    m_iconRect(KDRectZero),
     m_drawn(false)
   {
   }
@@ -79,6 +84,15 @@ public:
 
   void write(const char * string);
 
+  /* As in CPython, only every n-th update of the screen is performed: the
+   * lines and texts drawn since the previous update are drawn at once, the
+   * turtle is redrawn and the kandinsky off-screen buffer, if enabled, is
+   * pushed to the screen. With n = 0, the screen is only updated by update().
+   * Drawings of the kandinsky module are not deferred. */
+  uint16_t tracer() const { return m_tracer; }
+  void setTracer(uint16_t n);
+  void update();
+
   void viewDidDisappear();
 
   /* isOutOfBounds returns true if nothing should be drawn at current position.
@@ -86,7 +100,7 @@ public:
    * coordinate overflows. However, this solution makes the turtle go faster
    * when out of bound, and can prevent text that would have been visible to be
    * drawn. We use very large bounds to temper these effects. */
-  bool isOutOfBounds() const;
+  bool isOutOfBounds() const { return isOutOfBounds(m_x, m_y); }
 
 private:
   static constexpr mp_float_t k_headingScale = M_PI / 180;
@@ -118,6 +132,7 @@ private:
   };
 
   void setHeadingPrivate(mp_float_t angle);
+  bool isOutOfBounds(mp_float_t x, mp_float_t y) const;
   KDPoint position(mp_float_t x, mp_float_t y) const;
   KDPoint position() const { return position(m_x, m_y); }
 
@@ -127,20 +142,79 @@ private:
 
   KDRect iconRect() const;
 
+  /* A line is drawn with a pen dot on each pixel along its principal
+   * direction. The dots are numbered from 1 to numberOfDots(), the last one
+   * being at the end of the line: its start is the end of the previous line. */
+  class LineDots {
+  public:
+    LineDots(mp_float_t fromX, mp_float_t fromY, mp_float_t toX, mp_float_t toY);
+    int numberOfDots() const { return m_numberOfDots; }
+    mp_float_t x(int i) const;
+    mp_float_t y(int i) const;
+  private:
+    enum class PrincipalDirection : uint8_t {
+      None,
+      X,
+      Y
+    };
+    mp_float_t m_fromX;
+    mp_float_t m_fromY;
+    mp_float_t m_toX;
+    mp_float_t m_toY;
+    int m_numberOfDots;
+    PrincipalDirection m_principalDirection;
+    bool m_sameColumn;
+    bool m_sameRow;
+  };
+
   // Interruptible methods that return true if they have been interrupted
   bool draw(bool force);
-  bool dot(mp_float_t x, mp_float_t y);
+  /* Draw a line to (x, y) with pen dots. When walking, the turtle is redrawn at
+   * each step, otherwise it is only erased and the line is blended at once. */
+  bool drawLine(mp_float_t x, mp_float_t y, bool walk);
+  bool drawDeferredDrawings();
+
+  void dot(mp_float_t x, mp_float_t y);
+  // The number of dots whose positions blendLine computes at once
+  static constexpr int k_lineChunkSize = 32;
+  void blendLine(const LineDots & dots);
+  KDPoint dotOrigin(mp_float_t x, mp_float_t y) const { return position(x, y).translatedBy(KDPoint(-m_penSize/2, -m_penSize/2)); }
+  void increaseMileage(mp_float_t length);
+  void drawText(const char * string);
+  // Regular screen update at the end of a move
+  void refresh();
+
+  /* Until the next update, lines and texts are recorded with the state of the
+   * turtle rather than drawn. They return false if the drawing could not be
+   * recorded and has to be drawn right away, after the recorded ones. */
+  struct DeferredDrawing {
+    const char * text; // nullptr for a line from (x, y) to (toX, toY)
+    float x;
+    float y;
+    float toX;
+    float toY;
+    float heading;
+    KDColor color;
+    KDCoordinate penSize;
+  };
+  static constexpr int k_maxNumberOfDeferredDrawings = 128;
+  bool deferLine(mp_float_t x, mp_float_t y);
+  bool deferText(const char * string);
+  bool deferDrawing(const DeferredDrawing & drawing);
+  void flushDeferredDrawings();
 
   void drawPaw(PawType type, PawPosition position);
   void erase();
 
   /* When GC is performed, sTurtle is marked as root for GC collection and its
-   * data is scanned for pointers that point to the Python heap. We put the 3
+   * data is scanned for pointers that point to the Python heap. We put the 4
    * pointers that should be marked at the beginning of the object to maximize
-   * the chances they will be correctly aligned and interpreted as pointers. */
+   * the chances they will be correctly aligned and interpreted as pointers.
+   * The texts of the deferred drawings are reached through their buffer. */
   KDColor * m_underneathPixelBuffer;
   uint8_t * m_dotMask;
   KDColor * m_dotWorkingPixelBuffer;
+  DeferredDrawing * m_deferredDrawings;
 
   /* The frame's center is the center of the screen, the x axis goes to the
    * right and the y axis goes upwards. */
@@ -172,6 +246,11 @@ private:
 #endif
 
   uint16_t m_mileage;
+  uint16_t m_tracer;
+  uint16_t m_pendingUpdates;
+  uint16_t m_numberOfDeferredDrawings;
+  // The turtle may have moved since it was drawn, when updates are deferred
+  KDRect m_iconRect;
   bool m_drawn;
 
 };
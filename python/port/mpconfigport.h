@@ -24,6 +24,11 @@
 // Whether to include the garbage collector
 #define MICROPY_ENABLE_GC (1)
 
+/* Whether gc.threshold() can trigger collections before the heap is full. No
+ * threshold is set by default: collections only happen when the heap is full,
+ * unless a script sets one. */
+#define MICROPY_GC_ALLOC_THRESHOLD (1)
+
 // Whether to check C stack usage
 #define MICROPY_STACK_CHECK (1)
 
@@ -55,7 +60,7 @@
 #define MICROPY_PY_ASYNC_AWAIT (0)
 
 // Whether to support bytearray object
-#define MICROPY_PY_BUILTINS_BYTEARRAY (0)
+#define MICROPY_PY_BUILTINS_BYTEARRAY (1)
 
 // Whether to support frozenset object
 #define MICROPY_PY_BUILTINS_FROZENSET (1)
@@ -94,6 +99,7 @@
 #define MICROPY_PY_CMATH (1)
 
 // Whether to provide "gc" module
+// The port provides its own gc module, which also reports GC statistics
 #define MICROPY_PY_GC (0)
 
 // Whether to provide "io" module
@@ -117,11 +123,46 @@
 // Function to seed URANDOM with on init
 #define MICROPY_PY_URANDOM_SEED_INIT_FUNC micropython_port_random()
 
+/* Native code emitters, for the @micropython.native and @micropython.viper
+ * decorators. They are only enabled on targets whose calling convention the
+ * emitter supports and where RAM can be made executable: Thumb-2 on the
+ * device, and x86-64 on the Linux simulator. */
+#if PLATFORM_DEVICE
+#define MICROPY_EMIT_THUMB (1)
+#elif defined(__linux__) && defined(__x86_64__) && !defined(__ANDROID__)
+#define MICROPY_EMIT_X64 (1)
+#endif
+
 // Make a pointer to RAM callable (eg set lower bit for Thumb code)
 // (This scheme won't work if we want to mix Thumb and normal ARM code.)
+#if MICROPY_EMIT_THUMB
+#define MICROPY_MAKE_POINTER_CALLABLE(p) ((void *)((mp_uint_t)(p) | 1))
+#else
 #define MICROPY_MAKE_POINTER_CALLABLE(p) (p)
+#endif
+
+#if MICROPY_EMIT_THUMB
+/* The userland SRAM is executable, so native code is allocated on the Python
+ * heap. It is written through the data cache though, so the instruction cache
+ * has to be synchronized before running it. */
+#define MP_PLAT_COMMIT_EXEC(buf, len, reloc) micropython_port_commit_exec(buf, len)
+#elif MICROPY_EMIT_X64
+/* The simulator heap is not executable: native code goes to a dedicated
+ * executable arena instead. */
+#define MP_PLAT_ALLOC_EXEC(min_size, ptr, size) micropython_port_alloc_exec(min_size, ptr, size)
+#define MP_PLAT_FREE_EXEC(ptr, size) micropython_port_free_exec(ptr, size)
+#endif
+
+#define MICROPY_VM_HOOK_LOOP \
+  if (micropython_port_profiler_running) { \
+    micropython_port_profiler_sample(code_state, ip); \
+  } \
+  micropython_port_vm_hook_loop();
 
-#define MICROPY_VM_HOOK_LOOP micropython_port_vm_hook_loop();
+/* Without reverse special methods, which would change the dispatch of the
+ * operators of every class, numarray arrays get a last chance to handle the
+ * operations where they are the right operand only, as in 2 * a. */
+#define MICROPY_PORT_BINARY_OP_FALLBACK(op, lhs, rhs) micropython_port_binary_op_fallback(op, lhs, rhs)
 
 typedef intptr_t mp_int_t; // must be pointer size
 typedef uintptr_t mp_uint_t; // must be pointer size
@@ -135,18 +176,24 @@ typedef long mp_off_t;
 
 #define MP_STATE_PORT MP_STATE_VM
 
+extern const struct _mp_obj_module_t modgc_module;
 extern const struct _mp_obj_module_t modion_module;
 extern const struct _mp_obj_module_t modkandinsky_module;
 extern const struct _mp_obj_module_t modmatplotlib_module;
 extern const struct _mp_obj_module_t modpyplot_module;
+extern const struct _mp_obj_module_t modnumarray_module;
+extern const struct _mp_obj_module_t modprofiler_module;
 extern const struct _mp_obj_module_t modtime_module;
 extern const struct _mp_obj_module_t modturtle_module;
 
 #define MICROPY_PORT_BUILTIN_MODULES \
+    { MP_ROM_QSTR(MP_QSTR_gc), MP_ROM_PTR(&modgc_module) }, \
     { MP_ROM_QSTR(MP_QSTR_ion), MP_ROM_PTR(&modion_module) }, \
     { MP_ROM_QSTR(MP_QSTR_kandinsky), MP_ROM_PTR(&modkandinsky_module) }, \
     { MP_ROM_QSTR(MP_QSTR_matplotlib), MP_ROM_PTR(&modmatplotlib_module) }, \
     { MP_ROM_QSTR(MP_QSTR_matplotlib_dot_pyplot), MP_ROM_PTR(&modpyplot_module) }, \
+    { MP_ROM_QSTR(MP_QSTR_numarray), MP_ROM_PTR(&modnumarray_module) }, \
+    { MP_ROM_QSTR(MP_QSTR_profiler), MP_ROM_PTR(&modprofiler_module) }, \
     { MP_ROM_QSTR(MP_QSTR_time), MP_ROM_PTR(&modtime_module) }, \
     { MP_ROM_QSTR(MP_QSTR_turtle), MP_ROM_PTR(&modturtle_module) }, \
 
@@ -1,4 +1,5 @@
 #include "port.h"
+#include "profiler.h"
 
 #include <ion.h>
 #include <stdlib.h>
@@ -28,6 +29,7 @@ extern "C" {
 #include "py/runtime.h"
 #include "py/stackctrl.h"
 #include "mphalport.h"
+#include "mod/kandinsky/modkandinsky.h"
 #include "mod/turtle/modturtle.h"
 #include "mod/matplotlib/pyplot/modpyplot.h"
 }
@@ -35,6 +37,7 @@ extern "C" {
 #include <escher/palette.h>
 
 static MicroPython::ScriptProvider * sScriptProvider = nullptr;
+static MicroPython::GCStatistics sGCStatistics;
 static MicroPython::ExecutionEnvironment * sCurrentExecutionEnvironment = nullptr;
 
 MicroPython::ExecutionEnvironment::~ExecutionEnvironment() {
@@ -69,6 +72,12 @@ bool MicroPython::ExecutionEnvironment::runCode(const char * str) {
     HandleException(&nlr);
   }
 
+  // Report the profile of scripts which did not stop the profiler themselves
+  if (Profiler::isRunning()) {
+    Profiler::stop();
+    Profiler::printReport();
+  }
+
   // Disable the user interruption
   mp_hal_set_interrupt_char(-1);
 
@@ -165,11 +174,42 @@ void MicroPython::init(void * heapStart, void * heapEnd) {
   mp_stack_set_limit(29152);
 #endif
   gc_init(heapStart, heapEnd);
+  sGCStatistics = {0, 0, 0};
+  Profiler::reset();
+  micropython_port_vm_hook_reset();
+  micropython_port_reset_exec();
   mp_init();
 }
 
 void MicroPython::deinit() {
   mp_deinit();
+  modkandinsky_deinit();
+}
+
+/* The used memory is counted from the allocation table, which holds 2 bits per
+ * block of the heap. This reads a 64th of the size of the heap, where gc_info
+ * walks every block. */
+static size_t usedHeapMemory() {
+  const byte * table = MP_STATE_MEM(gc_alloc_table_start);
+  size_t numberOfUsedBlocks = 0;
+  for (size_t i = 0; i < MP_STATE_MEM(gc_alloc_table_byte_len); i++) {
+    // A block is used if any of its 2 bits is set
+    numberOfUsedBlocks += __builtin_popcount((table[i] | (table[i] >> 1)) & 0x55);
+  }
+  return numberOfUsedBlocks * MICROPY_BYTES_PER_GC_BLOCK;
+}
+
+static void updatePeakUsedMemory(MicroPython::GCStatistics * statistics) {
+  size_t used = usedHeapMemory();
+  if (used > statistics->peakUsedMemory) {
+    statistics->peakUsedMemory = used;
+  }
+}
+
+MicroPython::GCStatistics MicroPython::gcStatistics() {
+  GCStatistics statistics = sGCStatistics;
+  updatePeakUsedMemory(&statistics);
+  return statistics;
 }
 
 void MicroPython::registerScriptProvider(ScriptProvider * s) {
@@ -315,11 +355,17 @@ void gc_collect_regs_and_stack(void) {
 }
 
 void gc_collect(void) {
+  uint64_t startTime = Ion::Timing::millis();
+  updatePeakUsedMemory(&sGCStatistics);
   gc_collect_start();
+  modkandinsky_gc_collect();
   modturtle_gc_collect();
   modpyplot_gc_collect();
+  micropython_port_gc_collect_exec();
   gc_collect_regs_and_stack();
   gc_collect_end();
+  sGCStatistics.numberOfCollections++;
+  sGCStatistics.collectionTime += Ion::Timing::millis() - startTime;
 }
 
 void nlr_jump_fail(void *val) {
@@ -41,6 +41,18 @@ public:
 
 void init(void * heapStart, void * heapEnd);
 void deinit();
+
+/* Garbage collector statistics, reset upon init. The collection time is
+ * accumulated from millisecond timestamps, so it is only meaningful over many
+ * collections. The peak usage is sampled right before each collection, when
+ * the heap is the most used, and when the statistics are read. */
+struct GCStatistics {
+  uint32_t numberOfCollections;
+  uint32_t collectionTime; // ms
+  size_t peakUsedMemory; // bytes
+};
+GCStatistics gcStatistics();
+
 void registerScriptProvider(ScriptProvider * s);
 void collectRootsAtAddress(char * address, int len);
 
@@ -0,0 +1,148 @@
+#include "profiler.h"
+#include "helpers.h"
+#include <ion/timing.h>
+#include <assert.h>
+extern "C" {
+#include <py/bc.h>
+#include <py/mpprint.h>
+#include <py/runtime.h>
+}
+#if !PLATFORM_DEVICE
+#include <stdio.h>
+#endif
+
+/* The VM hook tests this flag before sampling: scripts which are not profiled
+ * only pay for that test. */
+bool micropython_port_profiler_running = false;
+
+static MicroPython::Profiler::Location sLocations[MicroPython::Profiler::k_numberOfLocations];
+static int sNumberOfLocations = 0;
+static uint32_t sOverflowTime = 0;
+static uint64_t sLastSampleTime = 0;
+
+void micropython_port_profiler_sample(const mp_code_state_t * codeState, const uint8_t * ip) {
+  uint64_t currentTime = Ion::Timing::millis();
+  if (currentTime == sLastSampleTime) {
+    return;
+  }
+  uint32_t elapsedTime = currentTime - sLastSampleTime;
+  sLastSampleTime = currentTime;
+
+  // Decode the prelude of the function, as the VM does to build tracebacks
+  const byte * prelude = codeState->fun_bc->bytecode;
+  MP_BC_PRELUDE_SIG_DECODE(prelude);
+  MP_BC_PRELUDE_SIZE_DECODE(prelude);
+  const byte * bytecodeStart = prelude + n_info + n_cell;
+#if !MICROPY_PERSISTENT_CODE
+  bytecodeStart = static_cast<const byte *>(MP_ALIGN(bytecodeStart, sizeof(mp_uint_t)));
+#endif
+#if MICROPY_PERSISTENT_CODE
+  qstr function = prelude[0] | (prelude[1] << 8);
+  qstr file = prelude[2] | (prelude[3] << 8);
+  prelude += 4;
+#else
+  qstr function = mp_decode_uint_value(prelude);
+  prelude = mp_decode_uint_skip(prelude);
+  qstr file = mp_decode_uint_value(prelude);
+  prelude = mp_decode_uint_skip(prelude);
+#endif
+  uint16_t line = mp_bytecode_get_source_line(prelude, ip - bytecodeStart);
+
+  for (int i = 0; i < sNumberOfLocations; i++) {
+    MicroPython::Profiler::Location * location = sLocations + i;
+    if (location->line == line && location->function == function && location->file == file) {
+      location->time += elapsedTime;
+      return;
+    }
+  }
+  if (sNumberOfLocations == MicroPython::Profiler::k_numberOfLocations) {
+    sOverflowTime += elapsedTime;
+    return;
+  }
+  sLocations[sNumberOfLocations++] = {function, file, line, elapsedTime};
+}
+
+namespace MicroPython {
+namespace Profiler {
+
+void start() {
+  reset();
+  sLastSampleTime = Ion::Timing::millis();
+  micropython_port_profiler_running = true;
+}
+
+void stop() {
+  micropython_port_profiler_running = false;
+}
+
+bool isRunning() {
+  return micropython_port_profiler_running;
+}
+
+const Location * locations(int * numberOfLocations, uint32_t * overflowTime) {
+  // Insertion sort, the table is small
+  for (int i = 1; i < sNumberOfLocations; i++) {
+    Location location = sLocations[i];
+    int j = i;
+    while (j > 0 && sLocations[j - 1].time < location.time) {
+      sLocations[j] = sLocations[j - 1];
+      j--;
+    }
+    sLocations[j] = location;
+  }
+  *numberOfLocations = sNumberOfLocations;
+  *overflowTime = sOverflowTime;
+  return sLocations;
+}
+
+#if !PLATFORM_DEVICE
+static void printToStandardError(void * env, const char * text, size_t length) {
+  fwrite(text, 1, length, stderr);
+}
+#endif
+
+static void printReportWith(const mp_print_t * print, const Location * hottestLocations, int numberOfLocations, uint32_t otherTime, uint32_t totalTime) {
+  mp_printf(print, "Profile: %u ms\n", (unsigned int)totalTime);
+  for (int i = 0; i < numberOfLocations; i++) {
+    const Location * location = hottestLocations + i;
+    mp_printf(print, "%3u%% %q:%u %q\n", (unsigned int)(100 * location->time / totalTime), location->file, (unsigned int)location->line, location->function);
+  }
+  if (otherTime > 0) {
+    mp_printf(print, "%3u%% other\n", (unsigned int)(100 * otherTime / totalTime));
+  }
+}
+
+void printReport() {
+  /* The console only fits a few lines, so only the hottest locations are
+   * listed and the others are summed up. */
+  constexpr int k_numberOfReportedLocations = 8;
+  int numberOfLocations;
+  uint32_t otherTime;
+  const Location * sortedLocations = locations(&numberOfLocations, &otherTime);
+  uint32_t totalTime = otherTime;
+  for (int i = 0; i < numberOfLocations; i++) {
+    totalTime += sortedLocations[i].time;
+    if (i >= k_numberOfReportedLocations) {
+      otherTime += sortedLocations[i].time;
+    }
+  }
+  if (totalTime == 0) {
+    return;
+  }
+  if (numberOfLocations > k_numberOfReportedLocations) {
+    numberOfLocations = k_numberOfReportedLocations;
+  }
+  printReportWith(&mp_plat_print, sortedLocations, numberOfLocations, otherTime, totalTime);
+#if !PLATFORM_DEVICE
+  const mp_print_t standardError = {nullptr, printToStandardError};
+  printReportWith(&standardError, sortedLocations, numberOfLocations, otherTime, totalTime);
+#endif
+}
+
+void reset() {
+  sNumberOfLocations = 0;
+  sOverflowTime = 0;
+}
+
+}
+}
@@ -0,0 +1,44 @@
+#ifndef PYTHON_PORT_PROFILER_H
+#define PYTHON_PORT_PROFILER_H
+
+extern "C" {
+#include <py/obj.h>
+#include <py/qstr.h>
+}
+#include <stdint.h>
+
+namespace MicroPython {
+
+/* Sampling profiler for Python scripts.
+ * While it is running, the VM hook looks up the function and line being
+ * executed once per millisecond and credits them with the time elapsed since
+ * the previous sample. The time spent in native code is credited to the next
+ * bytecode location reached, which is usually the caller.
+ * Samples are aggregated in a fixed table. Once it is full, the time of new
+ * locations goes to an overflow counter. */
+
+namespace Profiler {
+
+constexpr static int k_numberOfLocations = 32;
+
+struct Location {
+  qstr function;
+  qstr file;
+  uint16_t line;
+  uint32_t time; // ms
+};
+
+void start();
+void stop();
+bool isRunning();
+// Sort the locations by decreasing time and return them
+const Location * locations(int * numberOfLocations, uint32_t * overflowTime);
+// Print the hottest locations to the console, and to stderr on the simulator
+void printReport();
+void reset();
+
+}
+
+}
+
+#endif
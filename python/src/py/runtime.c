@@ -569,6 +569,15 @@ generic_binary_op:
         }
     }
 
+#ifdef MICROPY_PORT_BINARY_OP_FALLBACK
+    {
+        mp_obj_t result = MICROPY_PORT_BINARY_OP_FALLBACK(op, lhs, rhs);
+        if (result != MP_OBJ_NULL) {
+            return result;
+        }
+    }
+#endif
+
 #if MICROPY_PY_REVERSE_SPECIAL_METHODS
     if (op >= MP_BINARY_OP_OR && op <= MP_BINARY_OP_POWER) {
         mp_obj_t t = rhs;
@@ -13,3 +13,63 @@ QUIZ_CASE(python_template) {
   assert_script_execution_succeeds(Code::ScriptTemplate::Polynomial()->content());
   assert_script_execution_succeeds(Code::ScriptTemplate::Parabola()->content());
 }
+
+#if MICROPY_EMIT_NATIVE
+QUIZ_CASE(python_native_emitters) {
+  assert_script_execution_succeeds(R"(@micropython.native
+def f(n):
+  s = 0
+  for i in range(n):
+    s += i*i
+  return s
+@micropython.viper
+def g(n: int) -> int:
+  s = 0
+  for i in range(n):
+    s += i*i
+  return s
+print(f(100), g(100)))", "328350 328350\n");
+
+  /* The native and viper variants of the Mandelbrot template compute the same
+   * iteration counts. The viper variant runs on machine integers, with 12
+   * fractional bits, so it is allowed a few rounding differences. */
+  assert_script_execution_succeeds(R"(def escape(c, N_iteration):
+  z = complex(0,0)
+  i = 0
+  while (i < N_iteration) and abs(z) < 2:
+    i = i + 1
+    z = z*z+c
+  return i
+@micropython.native
+def escape_native(c, N_iteration):
+  z = complex(0,0)
+  i = 0
+  while (i < N_iteration) and abs(z) < 2:
+    i = i + 1
+    z = z*z+c
+  return i
+@micropython.viper
+def escape_viper(x: int, y: int, N_iteration: int) -> int:
+  c_r = 14336*x//319-10240
+  c_i = 5120-10240*y//221
+  z_r = 0
+  z_i = 0
+  i = 0
+  while (i < N_iteration) and z_r*z_r+z_i*z_i < 67108864:
+    i = i + 1
+    t = ((z_r*z_r-z_i*z_i)>>12)+c_r
+    z_i = ((2*z_r*z_i)>>12)+c_i
+    z_r = t
+  return i
+n = 0
+native = 0
+viper = 0
+for x in range(0,320,8):
+  for y in range(0,222,8):
+    i = escape(complex(3.5*x/319-2.5, -2.5*y/221+1.25), 15)
+    n += 1
+    native += escape_native(complex(3.5*x/319-2.5, -2.5*y/221+1.25), 15) != i
+    viper += escape_viper(x, y, 15) != i
+print(native, viper < n//50))", "0 True\n");
+}
+#endif
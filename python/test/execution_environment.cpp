@@ -38,7 +38,7 @@ void inlineToBeSingleInput(char * buffer, size_t bufferSize, const char * script
 }
 
 bool execute_input(TestExecutionEnvironment env, bool singleCommandLine, const char * input, const char * outputText = nullptr) {
-  constexpr size_t bufferSize = 1000;
+  constexpr size_t bufferSize = 4096;
   char buffer[bufferSize];
   if (!singleCommandLine) {
     inlineToBeSingleInput(buffer, bufferSize, input);
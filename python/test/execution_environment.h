@@ -15,6 +15,9 @@ private:
   size_t m_printTextIndex;
 };
 
+// Wrap a multi-line script into an exec() call that runCode can take
+void inlineToBeSingleInput(char * buffer, size_t bufferSize, const char * script);
+
 TestExecutionEnvironment init_environement();
 void deinit_environment();
 
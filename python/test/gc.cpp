@@ -0,0 +1,29 @@
+#include <quiz.h>
+#include "execution_environment.h"
+
+QUIZ_CASE(python_gc) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import gc");
+  assert_command_execution_succeeds(env, "gc.isenabled()", "True\n");
+  assert_command_execution_succeeds(env, "gc.disable()");
+  assert_command_execution_succeeds(env, "gc.isenabled()", "False\n");
+  assert_command_execution_succeeds(env, "gc.enable()");
+  assert_command_execution_succeeds(env, "gc.threshold()", "-1\n");
+  assert_command_execution_succeeds(env, "gc.threshold(4096)");
+  assert_command_execution_succeeds(env, "gc.threshold()", "4096\n");
+  // A threshold collects before the heap is full
+  assert_command_execution_succeeds(env, "n = gc.stats()['collections']");
+  assert_command_execution_succeeds(env, "for i in range(100):\n  l = [i]*64\n");
+  assert_command_execution_succeeds(env, "gc.stats()['collections'] > n", "True\n");
+  assert_command_execution_succeeds(env, "gc.threshold(-1)");
+  assert_command_execution_succeeds(env, "gc.mem_alloc() > 0", "True\n");
+  assert_command_execution_succeeds(env, "gc.mem_free() > 0", "True\n");
+  assert_command_execution_succeeds(env, "n = gc.stats()['collections']");
+  assert_command_execution_succeeds(env, "gc.collect()");
+  assert_command_execution_succeeds(env, "gc.stats()['collections'] > n", "True\n");
+  assert_command_execution_succeeds(env, "l = [0]*2000");
+  assert_command_execution_succeeds(env, "m = gc.mem_alloc()");
+  assert_command_execution_succeeds(env, "gc.stats()['peak'] >= m > 8000", "True\n");
+  assert_command_execution_succeeds(env, "gc.stats()['time'] >= 0", "True\n");
+  deinit_environment();
+}
@@ -26,3 +26,58 @@ QUIZ_CASE(python_kandinsky_basics) {
   assert_command_execution_succeeds(env, "draw_string('hello',0,0)");
   deinit_environment();
 }
+
+QUIZ_CASE(python_kandinsky_pixel_buffers) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  // Blue, green and red in little-endian RGB565
+  assert_command_execution_succeeds(env, "b=bytearray([31,0,224,7,0,248]*2)");
+  assert_command_execution_succeeds(env, "draw_pixels(10,10,3,2,b)");
+  assert_command_execution_succeeds(env, "assert get_pixels(10,10,3,2)==b");
+  assert_command_execution_succeeds(env, "assert get_pixel(11,11)==color(0,252,0)");
+  assert_command_execution_succeeds(env, "c=bytearray(6)");
+  assert_command_execution_succeeds(env, "assert get_pixels(10,11,3,1,c) is c");
+  assert_command_execution_succeeds(env, "assert c==b[6:]");
+  assert_command_execution_succeeds(env, "set_pixels(30,10,[(255,0,0),'blue','#00ff00'])");
+  assert_command_execution_succeeds(env, "assert get_pixels(30,10,3,1)==bytes([0,248,31,0,224,7])");
+  // Pixels out of the screen are clipped when drawn and read as black
+  assert_command_execution_succeeds(env, "draw_pixels(-1,-1,3,2,b)");
+  assert_command_execution_succeeds(env, "assert get_pixels(-1,-1,3,2)==bytes(8)+b[8:]");
+  assert_command_execution_succeeds(env, "assert get_pixels(320,0,2,1)==bytes(4)");
+  // Any object exposing its data works, whatever its alignment
+  assert_command_execution_succeeds(env, "draw_pixels(40,10,1,1,'__')");
+  assert_command_execution_fails(env, "draw_pixels(0,0,2,2,b)");
+  assert_command_execution_fails(env, "get_pixels(0,0,1,1,bytes(2))");
+  assert_command_execution_fails(env, "get_pixels(0,0,-1,2)");
+  assert_command_execution_fails(env, "set_pixels(0,0,['red']*321)");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_kandinsky_double_buffer) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  assert_command_execution_succeeds(env, "fill_rect(0,0,40,40,color(255,255,255))");
+  assert_command_execution_succeeds(env, "double_buffer(True,10,10,20,20)");
+  // Drawings and reads target the buffer, clipped to its rectangle
+  assert_command_execution_succeeds(env, "fill_rect(0,0,15,15,color(0,0,255))");
+  assert_command_execution_succeeds(env, "assert get_pixel(12,12)==color(0,0,255)");
+  assert_command_execution_succeeds(env, "assert get_pixel(5,5)!=color(0,0,255)");
+  assert_command_execution_succeeds(env, "draw_string('a',20,20)");
+  assert_command_execution_succeeds(env, "show()");
+  // Re-enabling or disabling pushes the pending changes first
+  assert_command_execution_succeeds(env, "set_pixel(25,25,color(0,255,0))");
+  assert_command_execution_succeeds(env, "double_buffer(False)");
+  assert_command_execution_succeeds(env, "assert get_pixels(10,10,3,1)==bytes([31,0]*3)");
+  assert_command_execution_succeeds(env, "assert get_pixel(5,5)==color(255,255,255)");
+  assert_command_execution_succeeds(env, "assert get_pixel(25,25)==color(0,255,0)");
+  assert_command_execution_succeeds(env, "show()");
+  // The rectangle has to be given, the whole sandbox does not fit in the heap
+  assert_command_execution_fails(env, "double_buffer(True)");
+  assert_command_execution_fails(env, "double_buffer(True,0,0)");
+  assert_command_execution_fails(env, "double_buffer(True,0,0,-1,1)");
+  // The buffer is allocated on the Python heap
+  assert_command_execution_fails(env, "double_buffer(True,0,0,30000,30000)");
+  // A buffer left enabled is dropped with the heap
+  assert_command_execution_succeeds(env, "double_buffer(True,0,0,8,8)");
+  deinit_environment();
+}
@@ -1,4 +1,7 @@
 #include <quiz.h>
+#include <cmath>
+#include <kandinsky/framebuffer_context.h>
+#include <python/port/mod/matplotlib/pyplot/plot_view.h>
 #include "execution_environment.h"
 
 QUIZ_CASE(python_matplotlib_pyplot_import) {
@@ -102,6 +105,99 @@ QUIZ_CASE(python_matplotlib_pyplot_plot) {
   deinit_environment();
 }
 
+QUIZ_CASE(python_matplotlib_pyplot_plot_many_points) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
+  // Points are unboxed into packed floats instead of being kept as tuples
+  assert_command_execution_succeeds(env, "x=[i/100 for i in range(400)]");
+  assert_command_execution_succeeds(env, "plot(x,x)");
+  assert_command_execution_succeeds(env, "plot(x)");
+  assert_command_execution_succeeds(env, "scatter(x,x)");
+  assert_command_execution_succeeds(env, "plot([0,float(\"nan\"),2],[1,2,3])");
+  assert_command_execution_fails(env, "plot([0,1],[1,\"a\"])");
+  assert_command_execution_succeeds(env, "show()");
+  deinit_environment();
+}
+
+/* The series are drawn in a 61x101 view, where the range makes 10 points of
+ * abscissa fall in each column and maps ordinates to rows 100-y. Coordinates
+ * are small integers, which take no room in the Python heap. */
+
+constexpr static KDCoordinate k_plotWidth = 61;
+constexpr static KDCoordinate k_plotHeight = 101;
+constexpr static int k_numberOfPoints = 600;
+
+static void draw_series(KDColor * pixels, int numberOfPoints, int (*x)(int), int (*y)(int), float yMax) {
+  Matplotlib::PlotStore store;
+  mp_obj_t * xItems = m_new(mp_obj_t, numberOfPoints);
+  mp_obj_t * yItems = m_new(mp_obj_t, numberOfPoints);
+  for (int i = 0; i < numberOfPoints; i++) {
+    xItems[i] = MP_OBJ_NEW_SMALL_INT(x(i));
+    yItems[i] = MP_OBJ_NEW_SMALL_INT(y(i));
+  }
+  store.addSeries(numberOfPoints, xItems, yItems, KDColorBlack, true);
+  store.setAxesRequested(false);
+  store.setAxesAuto(false);
+  store.setXMin(0.0f);
+  store.setXMax(10.0f * (k_plotWidth - 1));
+  store.setYMin(0.0f);
+  store.setYMax(yMax);
+  Matplotlib::PlotView view(&store);
+  view.setFrame(KDRect(0, 0, k_plotWidth, k_plotHeight), false);
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_plotWidth, k_plotHeight));
+  KDFrameBufferContext context(&frameBuffer);
+  view.drawRect(&context, view.bounds());
+}
+
+static int darkness(KDColor c) {
+  return 3 * 0xFF - c.red() - c.green() - c.blue();
+}
+
+// Mean row of a column, weighted by the darkness of its pixels
+static float mean_row(const KDColor * pixels, KDCoordinate column) {
+  float rows = 0.0f;
+  float weights = 0.0f;
+  for (int j = 0; j < k_plotHeight; j++) {
+    float weight = darkness(pixels[j * k_plotWidth + column]) - darkness(KDColorWhite);
+    rows += j * weight;
+    weights += weight;
+  }
+  return rows / weights;
+}
+
+QUIZ_CASE(python_matplotlib_pyplot_plot_decimation) {
+  TestExecutionEnvironment env = init_environement();
+  KDColor pixels[k_plotWidth * k_plotHeight];
+  KDColor referencePixels[k_plotWidth * k_plotHeight];
+
+  // The points of a column are drawn as a span from their lowest to highest
+  draw_series(pixels, k_numberOfPoints, [](int i) { return i; }, [](int i) { return i % 2 == 0 ? 20 : 80; }, k_plotHeight - 1);
+  for (KDCoordinate i = 1; i < k_plotWidth - 1; i++) {
+    for (KDCoordinate j = 0; j < k_plotHeight; j++) {
+      KDColor pixel = pixels[j * k_plotWidth + i];
+      if (j >= 22 && j <= 78) {
+        quiz_assert(pixel == KDColorBlack);
+      } else if (j < 18 || j > 82) {
+        quiz_assert(pixel == KDColorWhite);
+      }
+    }
+  }
+
+  // A straight line follows the line between its ends
+  draw_series(pixels, k_numberOfPoints, [](int i) { return i; }, [](int i) { return i; }, 600.0f);
+  draw_series(referencePixels, 2, [](int i) { return i * (k_numberOfPoints - 1); }, [](int i) { return i * (k_numberOfPoints - 1); }, 600.0f);
+  for (KDCoordinate i = 1; i < k_plotWidth - 2; i++) {
+    quiz_assert(std::fabs(mean_row(pixels, i) - mean_row(referencePixels, i)) < 1.0f);
+  }
+
+  // Points far out of the view are clamped to the KDCoordinate range
+  draw_series(pixels, 3, [](int i) { return i < 2 ? 300 * i : 1 << 28; }, [](int i) { return 50; }, k_plotHeight - 1);
+  for (KDCoordinate i = 1; i < k_plotWidth - 1; i++) {
+    quiz_assert(std::fabs(mean_row(pixels, i) - 50.0f) < 0.5f);
+  }
+  deinit_environment();
+}
+
 QUIZ_CASE(python_matplotlib_pyplot_scatter) {
   TestExecutionEnvironment env = init_environement();
   assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
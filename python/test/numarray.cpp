@@ -0,0 +1,112 @@
+#include <quiz.h>
+#include "execution_environment.h"
+
+QUIZ_CASE(python_numarray_basics) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from numarray import *");
+  assert_command_execution_succeeds(env, "a=array([1,2,3])");
+  assert_command_execution_succeeds(env, "a", "array([1.0, 2.0, 3.0], dtype=float32)\n");
+  assert_command_execution_succeeds(env, "len(a)", "3\n");
+  assert_command_execution_succeeds(env, "a[-1]", "3.0\n");
+  assert_command_execution_fails(env, "a[3]");
+  assert_command_execution_succeeds(env, "a[0]=0.5");
+  assert_command_execution_succeeds(env, "list(a)", "[0.5, 2.0, 3.0]\n");
+  assert_command_execution_succeeds(env, "a[1:]", "array([2.0, 3.0], dtype=float32)\n");
+  assert_command_execution_succeeds(env, "array((1.7,-2.5),int16)", "array([1, -2], dtype=int16)\n");
+  assert_command_execution_succeeds(env, "array(range(3),dtype=int32).tolist()", "[0, 1, 2]\n");
+  assert_command_execution_succeeds(env, "array([70000],int16)[0]", "4464\n");
+  assert_command_execution_fails(env, "array([1],dtype=1)");
+  assert_command_execution_succeeds(env, "zeros(12,dtype=float64)", "array([0.0, 0.0, 0.0, ..., 0.0, 0.0, 0.0], dtype=float64)\n");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_numarray_arithmetic) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from numarray import *");
+  assert_command_execution_succeeds(env, "a=array([1,2,3],int16)");
+  assert_command_execution_succeeds(env, "b=array([0.5,1,2])");
+  assert_command_execution_succeeds(env, "a+a", "array([2, 4, 6], dtype=int16)\n");
+  assert_command_execution_succeeds(env, "a*b", "array([0.5, 2.0, 6.0], dtype=float32)\n");
+  assert_command_execution_succeeds(env, "a/2", "array([0.5, 1.0, 1.5], dtype=float32)\n");
+  assert_command_execution_succeeds(env, "1-a", "array([0, -1, -2], dtype=int16)\n");
+  assert_command_execution_succeeds(env, "2.0*a", "array([2.0, 4.0, 6.0], dtype=float32)\n");
+  assert_command_execution_succeeds(env, "n=2");
+  assert_command_execution_fails(env, "n+=a");
+  assert_command_execution_succeeds(env, "a**2", "array([1, 4, 9], dtype=int16)\n");
+  assert_command_execution_succeeds(env, "-b", "array([-0.5, -1.0, -2.0], dtype=float32)\n");
+  assert_command_execution_succeeds(env, "abs(-a)", "array([1, 2, 3], dtype=int16)\n");
+  assert_command_execution_fails(env, "a+array([1,2])");
+  assert_command_execution_fails(env, "a+'a'");
+  // Augmented assignments modify the array in place and keep its type
+  assert_command_execution_succeeds(env, "c=a");
+  assert_command_execution_succeeds(env, "a+=b");
+  assert_command_execution_succeeds(env, "c", "array([1, 3, 5], dtype=int16)\n");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_numarray_reductions) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from numarray import *");
+  assert_command_execution_succeeds(env, "a=arange(1,5)");
+  assert_command_execution_succeeds(env, "a", "array([1, 2, 3, 4], dtype=int32)\n");
+  assert_command_execution_succeeds(env, "a.sum()", "10\n");
+  assert_command_execution_succeeds(env, "mean(a)", "2.5\n");
+  assert_command_execution_succeeds(env, "a.min(),a.max()", "(1, 4)\n");
+  assert_command_execution_fails(env, "zeros(0).max()");
+  // The module functions shadow the builtins, which they fall back to
+  assert_command_execution_succeeds(env, "sum([1,2]),sum([1],2)", "(3, 3)\n");
+  assert_command_execution_succeeds(env, "min(3,1),max([1,5]),min([],default=0)", "(1, 5, 0)\n");
+  assert_command_execution_succeeds(env, "max([a[:1],a],key=len)", "array([1, 2, 3, 4], dtype=int32)\n");
+  assert_command_execution_succeeds(env, "arange(0,1,0.25)", "array([0.0, 0.25, 0.5, 0.75], dtype=float32)\n");
+  assert_command_execution_succeeds(env, "arange(3,0,-1)", "array([3, 2, 1], dtype=int32)\n");
+  assert_command_execution_succeeds(env, "len(arange(5,0))", "0\n");
+  assert_command_execution_fails(env, "arange(0,1,0)");
+  assert_command_execution_succeeds(env, "linspace(0,1,5)", "array([0.0, 0.25, 0.5, 0.75, 1.0], dtype=float32)\n");
+  assert_command_execution_succeeds(env, "len(linspace(0,1))", "50\n");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_numarray_simulation) {
+  /* Two arrays of 2000 float32 fit in the 32 KB heap, where two lists of 2000
+   * floats do not. Augmented assignments do not allocate temporary arrays. */
+  assert_script_execution_succeeds(
+    "from numarray import *\n"
+    "x=zeros(2000)\n"
+    "v=linspace(0,1,2000)\n"
+    "for i in range(10):\n"
+    "  x+=v\n"
+    "  v*=0.9\n"
+    "assert abs(x.max()-6.5132156)<1e-5\n"
+    "assert abs(x.mean()-3.2566078)<1e-5\n"
+  );
+  assert_script_execution_fails(
+    "x=[0.0]*2000\n"
+    "v=[i/2000 for i in range(2000)]\n"
+  );
+}
+
+QUIZ_CASE(python_numarray_buffers) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from numarray import *");
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  // RGB565 colors are stored in int16 arrays
+  assert_command_execution_succeeds(env, "p=array([0xF800,0x07E0,0x001F],int16)");
+  assert_command_execution_succeeds(env, "draw_pixels(10,10,3,1,p)");
+  assert_command_execution_succeeds(env, "assert get_pixel(11,10)==color(0,252,0)");
+  assert_command_execution_succeeds(env, "q=zeros(3,dtype=int16)");
+  assert_command_execution_succeeds(env, "r=get_pixels(10,10,3,1,q)");
+  assert_command_execution_succeeds(env, "assert q[0]==p[0]");
+  deinit_environment();
+
+  env = init_environement();
+  assert_command_execution_succeeds(env, "from numarray import *");
+  assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
+  assert_command_execution_succeeds(env, "x=linspace(0,6,500)");
+  assert_command_execution_succeeds(env, "plot(x,x*x)");
+  assert_command_execution_succeeds(env, "plot(x)");
+  assert_command_execution_succeeds(env, "scatter(x,x,color='red')");
+  assert_command_execution_fails(env, "plot(x,x[1:])");
+  assert_command_execution_succeeds(env, "plot(x[:3],[1,2,3])");
+  assert_command_execution_succeeds(env, "show()");
+  deinit_environment();
+}
@@ -0,0 +1,35 @@
+#include <quiz.h>
+#include "execution_environment.h"
+
+QUIZ_CASE(python_profiler) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import profiler");
+  assert_command_execution_succeeds(env, "profiler.stats()", "[]\n");
+  // Stopping a profiler which is not running prints nothing
+  assert_command_execution_succeeds(env, "profiler.stop()");
+  deinit_environment();
+
+  /* The loop spins until it gets sampled rather than for a given time, so
+   * that only the attribution of the samples is checked, and the report it
+   * prints is not compared as it depends on timing. */
+  assert_script_execution_succeeds(R"(import profiler
+def spin():
+  n = 0
+  while not profiler.stats():
+    n += 1
+  return n
+def idle():
+  pass
+profiler.start()
+idle()
+spin()
+stats = profiler.stats()
+profiler.stop()
+assert len(stats) > 0
+assert all(s[0] == 'spin' and s[1] in (4, 5) and s[2] > 0 for s in stats)
+assert profiler.stats() == stats
+profiler.start()
+idle()
+profiler.stop()
+assert profiler.stats() == [])");
+}
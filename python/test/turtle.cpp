@@ -36,3 +36,66 @@ QUIZ_CASE(python_turtle_circle) {
   //assert_command_execution_succeeds(env, "position()", "(0.0, 0.0)\n");
   deinit_environment();
 }
+
+QUIZ_CASE(python_turtle_lines) {
+  // Lines are blended at once at speed(0) as they are dot by dot when walking
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from turtle import *");
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  assert_command_execution_succeeds(env, "fill_rect(0,0,320,222,color(255,255,255))");
+  assert_command_execution_succeeds(env, "hideturtle()");
+  assert_command_execution_succeeds(env, "pensize(5)");
+  assert_command_execution_succeeds(env, "color(200,40,0)");
+  assert_command_execution_succeeds(env, "def lines(x):\n  for (a,b,c,d) in ((-120,0,-100,-60),(-120,0,-60,10),(-40,-90,-90,-40),(-30,100,-60,130),(-145,-30,-150,-100)):\n    penup()\n    goto(x+a,b)\n    pendown()\n    goto(x+c,d)\n");
+  assert_command_execution_succeeds(env, "speed(10)");
+  assert_command_execution_succeeds(env, "lines(0)");
+  assert_command_execution_succeeds(env, "speed(0)");
+  assert_command_execution_succeeds(env, "lines(160)");
+  assert_command_execution_succeeds(env, "assert get_pixels(0,90,160,20)!=b'\\xff'*6400");
+  assert_command_execution_succeeds(env, "for y in range(0,222,6):\n  assert get_pixels(0,y,160,6)==get_pixels(160,y,160,6)\n");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_turtle_tracer) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from turtle import *");
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  assert_command_execution_succeeds(env, "fill_rect(0,0,320,222,color(255,255,255))");
+  assert_command_execution_succeeds(env, "tracer()", "1\n");
+  assert_command_execution_succeeds(env, "hideturtle()");
+  assert_command_execution_succeeds(env, "pensize(3)");
+  // The same line is drawn walking, at speed(0) and deferred by tracer(0)
+  assert_command_execution_succeeds(env, "penup()");
+  assert_command_execution_succeeds(env, "goto(-100,50)");
+  assert_command_execution_succeeds(env, "pendown()");
+  assert_command_execution_succeeds(env, "goto(-60,80)");
+  assert_command_execution_succeeds(env, "speed(0)");
+  assert_command_execution_succeeds(env, "penup()");
+  assert_command_execution_succeeds(env, "goto(-100,0)");
+  assert_command_execution_succeeds(env, "pendown()");
+  assert_command_execution_succeeds(env, "goto(-60,30)");
+  assert_command_execution_succeeds(env, "tracer(0)");
+  assert_command_execution_succeeds(env, "tracer()", "0\n");
+  assert_command_execution_succeeds(env, "penup()");
+  assert_command_execution_succeeds(env, "goto(-100,-50)");
+  assert_command_execution_succeeds(env, "pendown()");
+  assert_command_execution_succeeds(env, "goto(-60,-20)");
+  assert_command_execution_succeeds(env, "penup()");
+  assert_command_execution_succeeds(env, "goto(60,-50)");
+  assert_command_execution_succeeds(env, "write('a')");
+  assert_command_execution_succeeds(env, "position()", "(60.0, -50.0)\n");
+  // Nothing is drawn until the update
+  assert_command_execution_succeeds(env, "assert get_pixels(55,126,50,40)==b'\\xff'*4000");
+  assert_command_execution_succeeds(env, "assert get_pixels(220,130,20,30)==b'\\xff'*1200");
+  assert_command_execution_succeeds(env, "update()");
+  assert_command_execution_succeeds(env, "assert get_pixel(80,146)==color(0,0,0)");
+  assert_command_execution_succeeds(env, "assert get_pixels(220,130,20,30)!=b'\\xff'*1200");
+  assert_command_execution_succeeds(env, "assert get_pixels(55,26,50,40)==get_pixels(55,76,50,40)");
+  assert_command_execution_succeeds(env, "assert get_pixels(55,76,50,40)==get_pixels(55,126,50,40)");
+  assert_command_execution_succeeds(env, "tracer(2)");
+  assert_command_execution_succeeds(env, "goto(10,10)");
+  assert_command_execution_succeeds(env, "position()", "(10.0, 10.0)\n");
+  assert_command_execution_succeeds(env, "tracer(1)");
+  assert_command_execution_fails(env, "tracer(-1)");
+  deinit_environment();
+}
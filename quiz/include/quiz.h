@@ -9,6 +9,12 @@
 #define QUIZ_CASE(name) void quiz_case_##name()
 #endif
 
+/* A case declared with QUIZ_THREAD_SAFE_CASE only relies on the state of
+ * Poincare which is thread-local: it neither reads nor writes the storage, the
+ * preferences, nor any other shared state. The runner can run these cases
+ * concurrently. */
+#define QUIZ_THREAD_SAFE_CASE(name) QUIZ_CASE(name)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
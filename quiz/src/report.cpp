@@ -0,0 +1,89 @@
+#include "report.h"
+#include "quiz.h"
+#include "symbols.h"
+#include <stdio.h>
+
+static const char * statusName(CaseResult::Status status) {
+  switch (status) {
+    case CaseResult::Status::Passed:
+      return "passed";
+    case CaseResult::Status::Failed:
+    case CaseResult::Status::Running:
+      // A case still running when its worker stopped has failed
+      return "failed";
+    default:
+      return "not run";
+  }
+}
+
+void quiz_print_slowest_cases(const CaseResult * results, int numberOfCases, int numberOfSlowestCases) {
+  constexpr int k_bufferSize = 128;
+  char buffer[k_bufferSize];
+  quiz_print("SLOWEST CASES:");
+  /* Select the slowest cases one after the other: there are few of them
+   * compared to the number of cases. */
+  int previous = -1;
+  for (int n = 0; n < numberOfSlowestCases; n++) {
+    int slowest = -1;
+    for (int i = 0; i < numberOfCases; i++) {
+      bool afterPrevious = previous < 0 || results[i].time < results[previous].time || (results[i].time == results[previous].time && i > previous);
+      if (afterPrevious && (slowest < 0 || results[i].time > results[slowest].time)) {
+        slowest = i;
+      }
+    }
+    if (slowest < 0) {
+      break;
+    }
+    snprintf(buffer, k_bufferSize, "%8u ms %8u B  %s", static_cast<unsigned>(results[slowest].time), static_cast<unsigned>(results[slowest].poolHighWaterMark), quiz_case_names[slowest]);
+    quiz_print(buffer);
+    previous = slowest;
+  }
+}
+
+bool quiz_write_json_report(const char * path, const CaseResult * results, int numberOfCases) {
+  FILE * file = fopen(path, "w");
+  if (file == nullptr) {
+    return false;
+  }
+  // Case names are C identifiers, which need no escaping
+  fprintf(file, "{\n  \"cases\": [");
+  for (int i = 0; i < numberOfCases; i++) {
+    fprintf(file, "%s\n    {\"name\": \"%s\", \"status\": \"%s\", \"time_ms\": %u, \"pool_high_water_mark\": %u}",
+        i == 0 ? "" : ",",
+        quiz_case_names[i],
+        statusName(results[i].status),
+        static_cast<unsigned>(results[i].time),
+        static_cast<unsigned>(results[i].poolHighWaterMark));
+  }
+  fprintf(file, "\n  ]\n}\n");
+  return fclose(file) == 0;
+}
+
+bool quiz_write_junit_report(const char * path, const CaseResult * results, int numberOfCases) {
+  FILE * file = fopen(path, "w");
+  if (file == nullptr) {
+    return false;
+  }
+  int numberOfFailures = 0;
+  int numberOfSkippedCases = 0;
+  uint64_t totalTime = 0;
+  for (int i = 0; i < numberOfCases; i++) {
+    numberOfFailures += results[i].status == CaseResult::Status::Failed || results[i].status == CaseResult::Status::Running;
+    numberOfSkippedCases += results[i].status == CaseResult::Status::NotRun;
+    totalTime += results[i].time;
+  }
+  fprintf(file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+  fprintf(file, "<testsuite name=\"quiz\" tests=\"%d\" failures=\"%d\" skipped=\"%d\" time=\"%.3f\">\n", numberOfCases, numberOfFailures, numberOfSkippedCases, totalTime / 1000.0);
+  for (int i = 0; i < numberOfCases; i++) {
+    fprintf(file, "  <testcase classname=\"quiz\" name=\"%s\" time=\"%.3f\">\n", quiz_case_names[i], results[i].time / 1000.0);
+    fprintf(file, "    <properties><property name=\"pool_high_water_mark\" value=\"%u\"/></properties>\n", static_cast<unsigned>(results[i].poolHighWaterMark));
+    if (results[i].status == CaseResult::Status::NotRun) {
+      fprintf(file, "    <skipped/>\n");
+    } else if (results[i].status != CaseResult::Status::Passed) {
+      fprintf(file, "    <failure message=\"failed\"/>\n");
+    }
+    fprintf(file, "  </testcase>\n");
+  }
+  fprintf(file, "</testsuite>\n");
+  return fclose(file) == 0;
+}
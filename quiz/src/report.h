@@ -0,0 +1,27 @@
+#ifndef QUIZ_REPORT_H
+#define QUIZ_REPORT_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+/* The runner records the result of each case. Results live in memory shared
+ * with the worker processes, which fill them in. */
+
+struct CaseResult {
+  enum class Status : uint8_t {
+    NotRun,
+    Running,
+    Passed,
+    Failed
+  };
+  Status status;
+  pid_t worker; // Process which ran the case
+  uint32_t time; // Wall time, in ms
+  uint16_t poolHighWaterMark; // Largest size of the TreePool nodes, in bytes
+};
+
+void quiz_print_slowest_cases(const CaseResult * results, int numberOfCases, int numberOfSlowestCases);
+bool quiz_write_json_report(const char * path, const CaseResult * results, int numberOfCases);
+bool quiz_write_junit_report(const char * path, const CaseResult * results, int numberOfCases);
+
+#endif
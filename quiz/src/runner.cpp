@@ -4,23 +4,220 @@
 #include <poincare/init.h>
 #include <poincare/tree_pool.h>
 #include <poincare/exception_checkpoint.h>
+#include <stdlib.h>
+#include <string.h>
+#if POINCARE_THREAD_LOCAL_STATE
+#include <atomic>
+#include <mutex>
+#include <thread>
+#endif
+#if QUIZ_DESKTOP_RUNNER
+#include "report.h"
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#if POINCARE_THREAD_LOCAL_STATE
+// Cases running concurrently print whole lines
+static std::mutex s_printMutex;
+#endif
+
+#if QUIZ_DESKTOP_RUNNER
+static CaseResult * s_results = nullptr;
+static bool s_isWorkerProcess = false;
+#endif
 
 void quiz_print(const char * message) {
+#if QUIZ_DESKTOP_RUNNER
+  if (s_isWorkerProcess) {
+    /* Worker processes print concurrently: a line written at once is not
+     * interleaved with the others. */
+    constexpr int k_bufferSize = 256;
+    char buffer[k_bufferSize];
+    int length = snprintf(buffer, k_bufferSize, "%s\r\n", message);
+    if (length >= 0 && length < k_bufferSize) {
+      write(STDOUT_FILENO, buffer, length);
+      return;
+    }
+  }
+#endif
+#if POINCARE_THREAD_LOCAL_STATE
+  std::lock_guard<std::mutex> lock(s_printMutex);
+#endif
   Ion::Console::writeLine(message);
 }
 
-static inline void ion_main_inner() {
-  int i = 0;
-  while (quiz_cases[i] != NULL) {
-    QuizCase c = quiz_cases[i];
-    quiz_print(quiz_case_names[i]);
-    int initialPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
-    quiz_assert(initialPoolSize == 0);
-    c();
-    int currentPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
-    quiz_assert(initialPoolSize == currentPoolSize);
-    i++;
+static void run_case(int i) {
+  QuizCase c = quiz_cases[i];
+  quiz_print(quiz_case_names[i]);
+  Poincare::TreePool * pool = Poincare::TreePool::sharedPool();
+  int initialPoolSize = pool->numberOfNodes();
+  quiz_assert(initialPoolSize == 0);
+#if QUIZ_DESKTOP_RUNNER
+  CaseResult * result = s_results + i;
+  result->worker = getpid();
+  result->status = CaseResult::Status::Running;
+#if POINCARE_TREE_POOL_STATS
+  pool->resetHighWaterMark();
+#endif
+  uint64_t startTime = Ion::Timing::millis();
+#endif
+  c();
+#if QUIZ_DESKTOP_RUNNER
+  result->time = Ion::Timing::millis() - startTime;
+#if POINCARE_TREE_POOL_STATS
+  result->poolHighWaterMark = pool->highWaterMark();
+#endif
+#endif
+  int currentPoolSize = pool->numberOfNodes();
+  quiz_assert(initialPoolSize == currentPoolSize);
+#if QUIZ_DESKTOP_RUNNER
+  result->status = CaseResult::Status::Passed;
+#endif
+}
+
+#if POINCARE_THREAD_LOCAL_STATE
+/* Each worker computes in its own pool and takes the next thread-safe case
+ * until there is none left. */
+static void run_thread_safe_cases(std::atomic<int> * nextCase, int numberOfCases) {
+  Poincare::TreePool pool;
+  Poincare::TreePool::RegisterPool(&pool);
+  Poincare::ExceptionCheckpoint ecp;
+  if (ExceptionRun(ecp)) {
+    for (int i = nextCase->fetch_add(1); i < numberOfCases; i = nextCase->fetch_add(1)) {
+      if (quiz_case_thread_safe[i]) {
+        run_case(i);
+      }
+    }
+  } else {
+    quiz_assert(false);
+  }
+}
+#endif
+
+#if QUIZ_DESKTOP_RUNNER
+/* Each case runs in its own worker process, forked from the state the runner
+ * starts with, so that cases do not depend on the order in which they run.
+ * A failing case aborts its worker: the case it was running is then marked as
+ * failed and the other cases go on. */
+static bool fork_worker_process(int i) {
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    s_isWorkerProcess = true;
+    run_case(i);
+    _exit(0);
+  }
+  return pid > 0;
+}
+
+static void run_worker_processes(int numberOfJobs, int numberOfCases) {
+  int nextCase = 0;
+  int numberOfWorkers = 0;
+  while (nextCase < numberOfCases || numberOfWorkers > 0) {
+    while (nextCase < numberOfCases && numberOfWorkers < numberOfJobs) {
+      if (!fork_worker_process(nextCase)) {
+        // The case could not start
+        s_results[nextCase].status = CaseResult::Status::Failed;
+      } else {
+        numberOfWorkers++;
+      }
+      nextCase++;
+    }
+    int status;
+    pid_t worker = wait(&status);
+    if (worker < 0) {
+      break;
+    }
+    numberOfWorkers--;
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+      continue;
+    }
+    for (int i = 0; i < numberOfCases; i++) {
+      if (s_results[i].status == CaseResult::Status::Running && s_results[i].worker == worker) {
+        s_results[i].status = CaseResult::Status::Failed;
+      }
+    }
+  }
+}
+#endif
+
+struct RunnerOptions {
+  int numberOfThreads = 1;
+  int numberOfJobs = 1;
+  int numberOfSlowestCases = -1; // Default value depends on the number of jobs
+  const char * jsonReportPath = nullptr;
+  const char * junitReportPath = nullptr;
+};
+
+static inline void ion_main_inner(const RunnerOptions & options) {
+  int numberOfCases = 0;
+  while (quiz_cases[numberOfCases] != NULL) {
+    numberOfCases++;
+  }
+  int numberOfThreads = options.numberOfThreads;
+  bool runCasesInOrder = true;
+#if QUIZ_DESKTOP_RUNNER
+  s_results = static_cast<CaseResult *>(mmap(nullptr, (numberOfCases + 1) * sizeof(CaseResult), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0));
+  quiz_assert(s_results != MAP_FAILED);
+  /* Reports are written once every case has run, which a failing case
+   * running in the runner process would prevent: the cases run in worker
+   * processes whenever a report is requested, even with a single job. */
+  bool reportRequested = options.jsonReportPath != nullptr || options.junitReportPath != nullptr;
+  if (options.numberOfJobs > 1 || reportRequested) {
+    if (numberOfThreads > 1) {
+      quiz_print("--threads CANNOT BE COMBINED WITH --jobs, --json OR --junit");
+      quiz_assert(false);
+    }
+    run_worker_processes(options.numberOfJobs > 1 ? options.numberOfJobs : 1, numberOfCases);
+    runCasesInOrder = false;
+  }
+#endif
+#if POINCARE_THREAD_LOCAL_STATE
+  if (numberOfThreads > 1) {
+    /* Thread-safe cases run first, on the workers. The main thread then runs
+     * the other cases in order, as they may depend on each other. */
+    std::atomic<int> nextCase(0);
+    std::thread * workers = new std::thread[numberOfThreads];
+    for (int t = 0; t < numberOfThreads; t++) {
+      workers[t] = std::thread(run_thread_safe_cases, &nextCase, numberOfCases);
+    }
+    for (int t = 0; t < numberOfThreads; t++) {
+      workers[t].join();
+    }
+    delete[] workers;
   }
+#endif
+  for (int i = 0; runCasesInOrder && i < numberOfCases; i++) {
+    if (numberOfThreads <= 1 || !quiz_case_thread_safe[i]) {
+      run_case(i);
+    }
+  }
+#if QUIZ_DESKTOP_RUNNER
+  int numberOfSlowestCases = options.numberOfSlowestCases >= 0 ? options.numberOfSlowestCases : (options.numberOfJobs > 1 ? 10 : 0);
+  if (numberOfSlowestCases > 0) {
+    quiz_print_slowest_cases(s_results, numberOfCases, numberOfSlowestCases);
+  }
+  if (options.jsonReportPath != nullptr && !quiz_write_json_report(options.jsonReportPath, s_results, numberOfCases)) {
+    quiz_print("COULD NOT WRITE THE JSON REPORT");
+  }
+  if (options.junitReportPath != nullptr && !quiz_write_junit_report(options.junitReportPath, s_results, numberOfCases)) {
+    quiz_print("COULD NOT WRITE THE JUNIT REPORT");
+  }
+  bool allCasesPassed = true;
+  for (int i = 0; i < numberOfCases; i++) {
+    if (s_results[i].status != CaseResult::Status::Passed) {
+      quiz_print("TEST FAILURE WHILE TESTING:");
+      quiz_print(quiz_case_names[i]);
+      allCasesPassed = false;
+    }
+  }
+  munmap(s_results, (numberOfCases + 1) * sizeof(CaseResult));
+  s_results = nullptr;
+  quiz_assert(allCasesPassed);
+#endif
   quiz_print("ALL TESTS FINISHED");
 #ifdef PLATFORM_DEVICE
   while (1) {
@@ -41,9 +238,31 @@ void ion_main(int argc, const char * const argv[]) {
   Ion::setStackStart((void *)(&stackTop));
 #endif
 
+  RunnerOptions options;
+  for (int i = 1; i < argc - 1; i++) {
+#if POINCARE_THREAD_LOCAL_STATE
+    // "--threads N" runs the thread-safe cases on N threads
+    if (strcmp(argv[i], "--threads") == 0) {
+      options.numberOfThreads = atoi(argv[i+1]);
+    }
+#endif
+#if QUIZ_DESKTOP_RUNNER
+    // "--jobs N" runs the cases in N worker processes
+    if (strcmp(argv[i], "--jobs") == 0) {
+      options.numberOfJobs = atoi(argv[i+1]);
+    } else if (strcmp(argv[i], "--slowest") == 0) {
+      options.numberOfSlowestCases = atoi(argv[i+1]);
+    } else if (strcmp(argv[i], "--json") == 0) {
+      options.jsonReportPath = argv[i+1];
+    } else if (strcmp(argv[i], "--junit") == 0) {
+      options.junitReportPath = argv[i+1];
+    }
+#endif
+  }
+
   Poincare::ExceptionCheckpoint ecp;
   if (ExceptionRun(ecp)) {
-    ion_main_inner();
+    ion_main_inner(options);
   } else {
     // There has been a memory allocation problem
 #if POINCARE_TREE_LOG
@@ -6,7 +6,8 @@ BEGIN {
 
 #FIXME: Is there a way to capture subexpression in awk? The following gsub is
 #       kind of ugly
-/QUIZ_CASE\(([a-z0-9_]+)\)/ { gsub(/(QUIZ_CASE\()|(\))/, "", $1); tests = tests "quiz_case_" $1 "," }
+/QUIZ_CASE\(([a-z0-9_]+)\)/ { gsub(/(QUIZ_CASE\()|(\))/, "", $1); tests = tests "quiz_case_" $1 ","; threadSafety = threadSafety "  false,\n" }
+/QUIZ_THREAD_SAFE_CASE\(([a-z0-9_]+)\)/ { gsub(/(QUIZ_THREAD_SAFE_CASE\()|(\))/, "", $1); tests = tests "quiz_case_" $1 ","; threadSafety = threadSafety "  true,\n" }
 
 END {
   declarations = tests;
@@ -30,4 +31,9 @@ END {
   names = names "  NULL"
   print names;
   print "};"
+  print ""
+
+  print "bool quiz_case_thread_safe[] = {";
+  print threadSafety "  false";
+  print "};"
 }
@@ -1,4 +1,7 @@
+#include <stdbool.h>
+
 typedef void (*QuizCase)(void);
 
 extern QuizCase quiz_cases[];
 extern char * quiz_case_names[];
+extern bool quiz_case_thread_safe[];